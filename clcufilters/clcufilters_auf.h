@@ -1,118 +1,121 @@
-﻿// -----------------------------------------------------------------------------------------
-// clfilters by rigaya
-// -----------------------------------------------------------------------------------------
-//
-// The MIT License
-//
-// Copyright (c) 2022 rigaya
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-// ------------------------------------------------------------------------------------------
-
-#ifndef _CLCUFILTERS_AUF_H_
-#define _CLCUFILTERS_AUF_H_
-
-#include "rgy_osdep.h"
-#include <thread>
-#include <future>
-#include "rgy_shared_mem.h"
-#include "rgy_pipe.h"
-#include "rgy_event.h"
-#include "rgy_prm.h"
-#include "NVEncFilterParam.h"
-#include "rgy_log.h"
-#include "clcufilters_shared.h"
-#include "clcufilters_chain_prm.h"
-#include "filter.h"
-
-std::string getClfiltersExePath();
-std::string getCUfiltersExePath();
-
-struct clcuFiltersAufDevInfo {
-    CL_PLATFORM_DEVICE pd;
-    std::pair<int, int> cudaVer;
-    tstring devName;
-
-    clcuFiltersAufDevInfo() : pd(), cudaVer({ 0, 0}), devName() {};
-    clcuFiltersAufDevInfo(const CL_PLATFORM_DEVICE& cl_pd, const std::pair<int, int>& cc, const tstring& name) : pd(cl_pd), cudaVer(cc), devName(name) {};
-};
-
-class clcuFiltersAufDevices {
-public:
-    clcuFiltersAufDevices();
-    ~clcuFiltersAufDevices();
-    int createList();
-    const std::vector<clcuFiltersAufDevInfo>& getPlatforms();
-    const clcuFiltersAufDevInfo *findDevice(const int platform, const int device);
-protected:
-    static std::vector<clcuFiltersAufDevInfo> createDeviceList(const tstring& exePath);
-    std::vector<clcuFiltersAufDevInfo> m_platforms;
-    std::vector<std::future<std::vector<clcuFiltersAufDevInfo>>> m_platformAsync;
-};
-
-class clcuFiltersAuf {
-public:
-    clcuFiltersAuf();
-    ~clcuFiltersAuf();
-    int runProcess(const HINSTANCE aufHandle, const int maxw, const int maxh, const bool isCUDA);
-    void initShared();
-    BOOL funcProc(const clFilterChainParam& prm, FILTER *fp, FILTER_PROC_INFO *fpip);
-    void setLogLevel(const RGYParamLogLevel& loglevel) { m_log->setLogLevelAll(loglevel); }
-    bool isCUDA() const;
-protected:
-    clfitersSharedMesData *getMessagePtr() { return (clfitersSharedMesData*)m_sharedMessage->ptr(); }
-    
-    void AddMessage(RGYLogLevel log_level, const tstring &str) {
-        if (m_log == nullptr || log_level < m_log->getLogLevel(RGY_LOGT_CORE)) {
-            return;
-        }
-        auto lines = split(str, _T("\n"));
-        for (const auto &line : lines) {
-            if (line[0] != _T('\0')) {
-                m_log->write(log_level, RGY_LOGT_CORE, (_T("clcufilters[auf]: ") + line + _T("\n")).c_str());
-            }
-        }
-    }
-    void AddMessage(RGYLogLevel log_level, const TCHAR *format, ...) {
-        if (m_log == nullptr || log_level < m_log->getLogLevel(RGY_LOGT_CORE)) {
-            return;
-        }
-        va_list args;
-        va_start(args, format);
-        int len = _vsctprintf(format, args) + 1; // _vscprintf doesn't count terminating '\0'
-        tstring buffer;
-        buffer.resize(len, _T('\0'));
-        _vstprintf_s(&buffer[0], len, format, args);
-        va_end(args);
-        AddMessage(log_level, buffer);
-    }
-    std::unique_ptr<RGYPipeProcess> m_process;
-    unique_event m_eventMesStart;
-    unique_event m_eventMesEnd;
-    std::unique_ptr<RGYSharedMemWin> m_sharedMessage;
-    std::unique_ptr<RGYSharedMemWin> m_sharedPrms;
-    std::array<std::unique_ptr<RGYSharedMemWin>,2> m_sharedFrames;
-    int m_sharedFramesPitchBytes;
-    std::thread m_threadProcOut;
-    std::thread m_threadProcErr;
-    std::shared_ptr<RGYLog> m_log;
-};
-
+﻿// -----------------------------------------------------------------------------------------
+// clfilters by rigaya
+// -----------------------------------------------------------------------------------------
+//
+// The MIT License
+//
+// Copyright (c) 2022 rigaya
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// ------------------------------------------------------------------------------------------
+
+#ifndef _CLCUFILTERS_AUF_H_
+#define _CLCUFILTERS_AUF_H_
+
+#include "rgy_osdep.h"
+#include <thread>
+#include <future>
+#include "rgy_shared_mem.h"
+#include "rgy_pipe.h"
+#include "rgy_event.h"
+#include "rgy_prm.h"
+#include "NVEncFilterParam.h"
+#include "rgy_log.h"
+#include "convert_csp.h"
+#include "clcufilters_shared.h"
+#include "clcufilters_chain_prm.h"
+#include "filter.h"
+
+std::string getClfiltersExePath();
+std::string getCUfiltersExePath();
+
+struct clcuFiltersAufDevInfo {
+    CL_PLATFORM_DEVICE pd;
+    std::pair<int, int> cudaVer;
+    tstring devName;
+
+    clcuFiltersAufDevInfo() : pd(), cudaVer({ 0, 0}), devName() {};
+    clcuFiltersAufDevInfo(const CL_PLATFORM_DEVICE& cl_pd, const std::pair<int, int>& cc, const tstring& name) : pd(cl_pd), cudaVer(cc), devName(name) {};
+};
+
+class clcuFiltersAufDevices {
+public:
+    clcuFiltersAufDevices();
+    ~clcuFiltersAufDevices();
+    int createList();
+    const std::vector<clcuFiltersAufDevInfo>& getPlatforms();
+    const clcuFiltersAufDevInfo *findDevice(const int platform, const int device);
+protected:
+    static std::vector<clcuFiltersAufDevInfo> createDeviceList(const tstring& exePath);
+    std::vector<clcuFiltersAufDevInfo> m_platforms;
+    std::vector<std::future<std::vector<clcuFiltersAufDevInfo>>> m_platformAsync;
+};
+
+class clcuFiltersAuf {
+public:
+    clcuFiltersAuf();
+    ~clcuFiltersAuf();
+    int runProcess(const HINSTANCE aufHandle, const int maxw, const int maxh, const bool isCUDA, const int cacheHostMB, const bool workSizeTune);
+    void initShared();
+    BOOL funcProc(const clFilterChainParam& prm, FILTER *fp, FILTER_PROC_INFO *fpip);
+    void setLogLevel(const RGYParamLogLevel& loglevel) { m_log->setLogLevelAll(loglevel); }
+    bool isCUDA() const;
+protected:
+    clfitersSharedMesData *getMessagePtr() { return (clfitersSharedMesData*)m_sharedMessage->ptr(); }
+    
+    void AddMessage(RGYLogLevel log_level, const tstring &str) {
+        if (m_log == nullptr || log_level < m_log->getLogLevel(RGY_LOGT_CORE)) {
+            return;
+        }
+        auto lines = split(str, _T("\n"));
+        for (const auto &line : lines) {
+            if (line[0] != _T('\0')) {
+                m_log->write(log_level, RGY_LOGT_CORE, (_T("clcufilters[auf]: ") + line + _T("\n")).c_str());
+            }
+        }
+    }
+    void AddMessage(RGYLogLevel log_level, const TCHAR *format, ...) {
+        if (m_log == nullptr || log_level < m_log->getLogLevel(RGY_LOGT_CORE)) {
+            return;
+        }
+        va_list args;
+        va_start(args, format);
+        int len = _vsctprintf(format, args) + 1; // _vscprintf doesn't count terminating '\0'
+        tstring buffer;
+        buffer.resize(len, _T('\0'));
+        _vstprintf_s(&buffer[0], len, format, args);
+        va_end(args);
+        AddMessage(log_level, buffer);
+    }
+    std::unique_ptr<RGYPipeProcess> m_process;
+    unique_event m_eventMesStart;
+    unique_event m_eventMesEnd;
+    std::unique_ptr<RGYSharedMemWin> m_sharedMessage;
+    std::unique_ptr<RGYSharedMemWin> m_sharedPrms;
+    std::array<std::unique_ptr<RGYSharedMemWin>,2> m_sharedFrames;
+    int m_sharedFramesPitchBytes;
+    int m_sharedFramesPlanePitchBytes; // YUV444(16bit)で格納する場合の各プレーンのpitch
+    const ConvertCSP *m_convertYC48ToYUV444_16; // AviUtl側でYUV444(16bit)に変換する場合の変換関数
+    std::thread m_threadProcOut;
+    std::thread m_threadProcErr;
+    std::shared_ptr<RGYLog> m_log;
+};
+
 #endif // _CLCUFILTERS_AUF_H_
\ No newline at end of file
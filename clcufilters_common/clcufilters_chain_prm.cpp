@@ -1,238 +1,401 @@
-﻿// -----------------------------------------------------------------------------------------
-// clfilters by rigaya
-// -----------------------------------------------------------------------------------------
-//
-// The MIT License
-//
-// Copyright (c) 2024 rigaya
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-// ------------------------------------------------------------------------------------------
-
-#include "clcufilters_chain_prm.h"
-#include "rgy_cmd.h"
-#include "rgy_util.h"
-
-const TCHAR *cmd_short_opt_to_long(const TCHAR short_opt) {
-    switch (short_opt) {
-    case _T('p'): return _T("ppid");
-    default: return nullptr;
-    }
-}
-
-AviutlAufExeParams::AviutlAufExeParams() :
-    log_level(RGY_LOG_INFO),
-    logfile(),
-    noNVCL(true),
-    clinfo(false),
-    checkDevice(false),
-    ppid(0),
-    max_w(0),
-    max_h(0),
-    sizeSharedPrm(0),
-    sizeSharedMesData(0),
-    sizePIXELYC(0),
-    eventMesStart(nullptr),
-    eventMesEnd(nullptr)
-{}
-AviutlAufExeParams::~AviutlAufExeParams() {}
-
-clFilterChainParam::clFilterChainParam() :
-    hModule(NULL),
-    vpp(),
-    vppnv(),
-    log_level(RGY_LOG_QUIET),
-    log_to_file(false),
-    outWidth(),
-    outHeight() {
-
-}
-
-bool clFilterChainParam::operator==(const clFilterChainParam &x) const {
-    return hModule == x.hModule
-        && vpp == x.vpp
-        && vppnv == x.vppnv
-        && log_level == x.log_level
-        && log_to_file == x.log_to_file
-        && outWidth == x.outWidth
-        && outHeight == x.outHeight;
-}
-bool clFilterChainParam::operator!=(const clFilterChainParam &x) const {
-    return !(*this == x);
-}
-
-tstring clFilterChainParam::genCmd() const {
-    RGYParamVpp defaultPrm;
-    VppParam vppnvDefault;
-    tstring str = gen_cmd(&vpp, &defaultPrm, false);
-    str += gen_cmd(&vppnv, &vppnvDefault, vpp.resize_algo, false);
-    str += _T(" --log-level ") + log_level.to_string();
-    if (log_to_file) {
-        str += _T(" --log-to-file");
-    }
-    str += strsprintf(_T(" --out-width %d"), outWidth);
-    str += strsprintf(_T(" --out-height %d"), outHeight);
-    return str;
-}
-
-int ParseOneOption(const TCHAR *option_name, const TCHAR* strInput[], int& i, int nArgNum, clFilterChainParam *pParams, sArgsData *argData) {
-    if (IS_OPTION("log-level")) {
-        i++;
-        RGYParamLogLevel loglevel;
-        if (parse_log_level_param(option_name, strInput[i], loglevel) != 0) {
-            print_cmd_error_invalid_value(option_name, strInput[i]);
-            return 1;
-        }
-        pParams->log_level = loglevel;
-        return 0;
-    }
-    if (IS_OPTION("log-to-file")) {
-        pParams->log_to_file = true;
-        return 0;
-    }
-    if (IS_OPTION("out-width")) {
-        i++;
-        int value = 0;
-        if (_stscanf_s(strInput[i], _T("%d"), &value) != 1) {
-            print_cmd_error_invalid_value(option_name, strInput[i]);
-            return 1;
-        }
-        pParams->outWidth = value;
-        return 0;
-    }
-    if (IS_OPTION("out-height")) {
-        i++;
-        int value = 0;
-        if (_stscanf_s(strInput[i], _T("%d"), &value) != 1) {
-            print_cmd_error_invalid_value(option_name, strInput[i]);
-            return 1;
-        }
-        pParams->outHeight = value;
-        return 0;
-    }
-
-    int ret = parse_one_vppnv_option(option_name, strInput, i, nArgNum, &pParams->vppnv, argData, pParams->vpp.resize_algo);
-    if (ret >= 0) return ret;
-
-    ret = parse_one_vpp_option(option_name, strInput, i, nArgNum, &pParams->vpp, argData);
-    if (ret >= 0) return ret;
-
-    print_cmd_error_unknown_opt(strInput[i]);
-    return 1;
-#undef IS_OPTION
-}
-
-void clFilterChainParam::setPrmFromCmd(const tstring& cmda) {
-    const bool ignore_parse_err = true;
-    std::wstring cmd = char_to_wstring(cmda);
-    int argc = 0;
-    auto argvw = CommandLineToArgvW(cmd.c_str(), &argc);
-    if (argc <= 1) {
-        return;
-    }
-    const int nArgNum = argc;
-    vector<tstring> argv_tstring;
-    if (wcslen(argvw[0]) != 0) {
-        argv_tstring.push_back(_T("")); // 最初は実行ファイルのパスが入っているのを模擬するため、空文字列を入れておく
-    }
-    for (int i = 0; i < argc; i++) {
-        argv_tstring.push_back(wstring_to_tstring(argvw[i]));
-    }
-    LocalFree(argvw);
-
-    std::vector<TCHAR *> argv_tchar;
-    for (size_t i = 0; i < argv_tstring.size(); i++) {
-        argv_tchar.push_back((TCHAR *)argv_tstring[i].data());
-    }
-    argv_tchar.push_back((TCHAR *)_T("")); // 最後に空白を追加
-    const TCHAR **strInput = (const TCHAR **)argv_tchar.data();
-    sArgsData argsData;
-    for (int i = 1; i < nArgNum; i++) {
-        if (strInput[i] == nullptr) {
-            return;
-        }
-
-        const TCHAR *option_name = nullptr;
-
-        if (strInput[i][0] == _T('|')) {
-            break;
-        } else if (strInput[i][0] == _T('-')) {
-            if (strInput[i][1] == _T('-')) {
-                option_name = &strInput[i][2];
-            } else if (strInput[i][2] == _T('\0')) {
-                if (nullptr == (option_name = cmd_short_opt_to_long(strInput[i][1]))) {
-                    print_cmd_error_invalid_value(tstring(), tstring(), strsprintf(_T("Unknown option: \"%s\""), strInput[i]));
-                    return;
-                }
-            }
-            else {
-                if (ignore_parse_err) continue;
-                print_cmd_error_invalid_value(tstring(), tstring(), strsprintf(_T("Invalid option: \"%s\""), strInput[i]));
-                return;
-            }
-        }
-
-        if (option_name == nullptr) {
-            if (ignore_parse_err) continue;
-            print_cmd_error_unknown_opt(strInput[i]);
-            return;
-        }
-        int sts = ParseOneOption(option_name, strInput, i, nArgNum, this, &argsData);
-        if (!ignore_parse_err && sts != 0) {
-            return;
-        }
-    }
-}
-
-
-std::vector<VppType> clFilterChainParam::getFilterChain(const bool resizeRequired) const {
-    std::vector<VppType> allFilterOrder = vpp.filterOrder; // 指定の順序
-    // 指定の順序にないフィルタを追加
-    for (const auto& f : filterList) {
-        if (std::find(allFilterOrder.begin(), allFilterOrder.end(), f.second) == allFilterOrder.end()) {
-            allFilterOrder.push_back(f.second);
-        }
-    }
-    // 有効なフィルタだけを抽出
-    std::vector<VppType> enabledFilterOrder;
-    for (const auto filterType : allFilterOrder) {
-        if (  (vpp.colorspace.enable               && filterType == VppType::CL_COLORSPACE)
-           || (vpp.libplacebo_tonemapping.enable   && filterType == VppType::CL_LIBPLACEBO_TONEMAP)
-           || (vpp.nnedi.enable                    && filterType == VppType::CL_NNEDI)
-           || (vppnv.nvvfxDenoise.enable           && filterType == VppType::NVVFX_DENOISE)
-           || (vppnv.nvvfxArtifactReduction.enable && filterType == VppType::NVVFX_ARTIFACT_REDUCTION)
-           || (vpp.smooth.enable                   && filterType == VppType::CL_DENOISE_SMOOTH)
-           || (vpp.dct.enable                      && filterType == VppType::CL_DENOISE_DCT)
-           || (vpp.knn.enable                      && filterType == VppType::CL_DENOISE_KNN)
-           || (vpp.nlmeans.enable                  && filterType == VppType::CL_DENOISE_NLMEANS)
-           || (vpp.pmd.enable                      && filterType == VppType::CL_DENOISE_PMD)
-           || (resizeRequired                      && filterType == VppType::CL_RESIZE)
-           || (vpp.unsharp.enable                  && filterType == VppType::CL_UNSHARP)
-           || (vpp.edgelevel.enable                && filterType == VppType::CL_EDGELEVEL)
-           || (vpp.warpsharp.enable                && filterType == VppType::CL_WARPSHARP)
-           || (vpp.tweak.enable                    && filterType == VppType::CL_TWEAK)
-           || (vpp.deband.enable                   && filterType == VppType::CL_DEBAND)
-           || (vpp.libplacebo_deband.enable        && filterType == VppType::CL_LIBPLACEBO_DEBAND)
-           || (vppnv.ngxTrueHDR.enable             && filterType == VppType::NGX_TRUEHDR)) {
-            enabledFilterOrder.push_back(filterType);
-        }
-    }
-    return enabledFilterOrder;
-}
\ No newline at end of file
+﻿// -----------------------------------------------------------------------------------------
+// clfilters by rigaya
+// -----------------------------------------------------------------------------------------
+//
+// The MIT License
+//
+// Copyright (c) 2024 rigaya
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// ------------------------------------------------------------------------------------------
+
+#include <cmath>
+#include "clcufilters_chain_prm.h"
+#include "rgy_cmd.h"
+#include "rgy_util.h"
+
+const TCHAR *cmd_short_opt_to_long(const TCHAR short_opt) {
+    switch (short_opt) {
+    case _T('p'): return _T("ppid");
+    default: return nullptr;
+    }
+}
+
+AviutlAufExeParams::AviutlAufExeParams() :
+    log_level(RGY_LOG_INFO),
+    logfile(),
+    noNVCL(true),
+    clinfo(false),
+    checkDevice(false),
+    checkConvertCsp(false),
+    benchLaunch(false),
+    ppid(0),
+    max_w(0),
+    max_h(0),
+    sizeSharedPrm(0),
+    sizeSharedMesData(0),
+    sizePIXELYC(0),
+    cacheHostMB(0),
+    colorspaceLUTBake(0),
+    cspThreads(0),
+    cspThreadParam(),
+    pipelineThread(true),
+    launchReplay(false),
+    frameArena(true),
+    transferStaging(true),
+    chainFp16(CLCU_CHAIN_FP16_OFF),
+    workSizeTune(false),
+    eventMesStart(nullptr),
+    eventMesEnd(nullptr)
+{}
+AviutlAufExeParams::~AviutlAufExeParams() {}
+
+clFilterChainParam::clFilterChainParam() :
+    hModule(NULL),
+    vpp(),
+    vppnv(),
+    log_level(RGY_LOG_QUIET),
+    log_to_file(false),
+    outWidth(),
+    outHeight(),
+    draftScale(0) {
+
+}
+
+bool clFilterChainParam::operator==(const clFilterChainParam &x) const {
+    return hModule == x.hModule
+        && vpp == x.vpp
+        && vppnv == x.vppnv
+        && log_level == x.log_level
+        && log_to_file == x.log_to_file
+        && outWidth == x.outWidth
+        && outHeight == x.outHeight
+        && draftScale == x.draftScale;
+}
+bool clFilterChainParam::operator!=(const clFilterChainParam &x) const {
+    return !(*this == x);
+}
+
+tstring clFilterChainParam::genCmd() const {
+    RGYParamVpp defaultPrm;
+    VppParam vppnvDefault;
+    tstring str = gen_cmd(&vpp, &defaultPrm, false);
+    str += gen_cmd(&vppnv, &vppnvDefault, vpp.resize_algo, false);
+    str += _T(" --log-level ") + log_level.to_string();
+    if (log_to_file) {
+        str += _T(" --log-to-file");
+    }
+    str += strsprintf(_T(" --out-width %d"), outWidth);
+    str += strsprintf(_T(" --out-height %d"), outHeight);
+    if (draftScale > 1) {
+        str += strsprintf(_T(" --draft-scale %d"), draftScale);
+    }
+    return str;
+}
+
+int ParseOneOption(const TCHAR *option_name, const TCHAR* strInput[], int& i, int nArgNum, clFilterChainParam *pParams, sArgsData *argData) {
+    if (IS_OPTION("log-level")) {
+        i++;
+        RGYParamLogLevel loglevel;
+        if (parse_log_level_param(option_name, strInput[i], loglevel) != 0) {
+            print_cmd_error_invalid_value(option_name, strInput[i]);
+            return 1;
+        }
+        pParams->log_level = loglevel;
+        return 0;
+    }
+    if (IS_OPTION("log-to-file")) {
+        pParams->log_to_file = true;
+        return 0;
+    }
+    if (IS_OPTION("out-width")) {
+        i++;
+        int value = 0;
+        if (_stscanf_s(strInput[i], _T("%d"), &value) != 1) {
+            print_cmd_error_invalid_value(option_name, strInput[i]);
+            return 1;
+        }
+        pParams->outWidth = value;
+        return 0;
+    }
+    if (IS_OPTION("out-height")) {
+        i++;
+        int value = 0;
+        if (_stscanf_s(strInput[i], _T("%d"), &value) != 1) {
+            print_cmd_error_invalid_value(option_name, strInput[i]);
+            return 1;
+        }
+        pParams->outHeight = value;
+        return 0;
+    }
+    if (IS_OPTION("draft-scale")) {
+        i++;
+        int value = 0;
+        if (_stscanf_s(strInput[i], _T("%d"), &value) != 1 || value < 0) {
+            print_cmd_error_invalid_value(option_name, strInput[i]);
+            return 1;
+        }
+        pParams->draftScale = value;
+        return 0;
+    }
+
+    int ret = parse_one_vppnv_option(option_name, strInput, i, nArgNum, &pParams->vppnv, argData, pParams->vpp.resize_algo);
+    if (ret >= 0) return ret;
+
+    ret = parse_one_vpp_option(option_name, strInput, i, nArgNum, &pParams->vpp, argData);
+    if (ret >= 0) return ret;
+
+    print_cmd_error_unknown_opt(strInput[i]);
+    return 1;
+#undef IS_OPTION
+}
+
+void clFilterChainParam::setPrmFromCmd(const tstring& cmda) {
+    const bool ignore_parse_err = true;
+    std::wstring cmd = char_to_wstring(cmda);
+    int argc = 0;
+    auto argvw = CommandLineToArgvW(cmd.c_str(), &argc);
+    if (argc <= 1) {
+        return;
+    }
+    const int nArgNum = argc;
+    vector<tstring> argv_tstring;
+    if (wcslen(argvw[0]) != 0) {
+        argv_tstring.push_back(_T("")); // 最初は実行ファイルのパスが入っているのを模擬するため、空文字列を入れておく
+    }
+    for (int i = 0; i < argc; i++) {
+        argv_tstring.push_back(wstring_to_tstring(argvw[i]));
+    }
+    LocalFree(argvw);
+
+    std::vector<TCHAR *> argv_tchar;
+    for (size_t i = 0; i < argv_tstring.size(); i++) {
+        argv_tchar.push_back((TCHAR *)argv_tstring[i].data());
+    }
+    argv_tchar.push_back((TCHAR *)_T("")); // 最後に空白を追加
+    const TCHAR **strInput = (const TCHAR **)argv_tchar.data();
+    sArgsData argsData;
+    for (int i = 1; i < nArgNum; i++) {
+        if (strInput[i] == nullptr) {
+            return;
+        }
+
+        const TCHAR *option_name = nullptr;
+
+        if (strInput[i][0] == _T('|')) {
+            break;
+        } else if (strInput[i][0] == _T('-')) {
+            if (strInput[i][1] == _T('-')) {
+                option_name = &strInput[i][2];
+            } else if (strInput[i][2] == _T('\0')) {
+                if (nullptr == (option_name = cmd_short_opt_to_long(strInput[i][1]))) {
+                    print_cmd_error_invalid_value(tstring(), tstring(), strsprintf(_T("Unknown option: \"%s\""), strInput[i]));
+                    return;
+                }
+            }
+            else {
+                if (ignore_parse_err) continue;
+                print_cmd_error_invalid_value(tstring(), tstring(), strsprintf(_T("Invalid option: \"%s\""), strInput[i]));
+                return;
+            }
+        }
+
+        if (option_name == nullptr) {
+            if (ignore_parse_err) continue;
+            print_cmd_error_unknown_opt(strInput[i]);
+            return;
+        }
+        int sts = ParseOneOption(option_name, strInput, i, nArgNum, this, &argsData);
+        if (!ignore_parse_err && sts != 0) {
+            return;
+        }
+    }
+}
+
+
+std::vector<VppType> clFilterChainParam::getFilterChain(const bool resizeRequired) const {
+    std::vector<VppType> allFilterOrder = vpp.filterOrder; // 指定の順序
+    // 指定の順序にないフィルタを追加
+    for (const auto& f : filterList) {
+        if (std::find(allFilterOrder.begin(), allFilterOrder.end(), f.second) == allFilterOrder.end()) {
+            allFilterOrder.push_back(f.second);
+        }
+    }
+    // 有効なフィルタだけを抽出
+    std::vector<VppType> enabledFilterOrder;
+    for (const auto filterType : allFilterOrder) {
+        if (  (vpp.colorspace.enable               && filterType == VppType::CL_COLORSPACE)
+           || (vpp.libplacebo_tonemapping.enable   && filterType == VppType::CL_LIBPLACEBO_TONEMAP)
+           || (vpp.nnedi.enable                    && filterType == VppType::CL_NNEDI)
+           || (vppnv.nvvfxDenoise.enable           && filterType == VppType::NVVFX_DENOISE)
+           || (vppnv.nvvfxArtifactReduction.enable && filterType == VppType::NVVFX_ARTIFACT_REDUCTION)
+           || (vpp.smooth.enable                   && filterType == VppType::CL_DENOISE_SMOOTH)
+           || (vpp.dct.enable                      && filterType == VppType::CL_DENOISE_DCT)
+           || (vpp.knn.enable                      && filterType == VppType::CL_DENOISE_KNN)
+           || (vpp.nlmeans.enable                  && filterType == VppType::CL_DENOISE_NLMEANS)
+           || (vpp.pmd.enable                      && filterType == VppType::CL_DENOISE_PMD)
+           || (resizeRequired                      && filterType == VppType::CL_RESIZE)
+           || (vpp.unsharp.enable                  && filterType == VppType::CL_UNSHARP)
+           || (vpp.edgelevel.enable                && filterType == VppType::CL_EDGELEVEL)
+           || (vpp.warpsharp.enable                && filterType == VppType::CL_WARPSHARP)
+           || (vpp.tweak.enable                    && filterType == VppType::CL_TWEAK)
+           || (vpp.deband.enable                   && filterType == VppType::CL_DEBAND)
+           || (vpp.libplacebo_deband.enable        && filterType == VppType::CL_LIBPLACEBO_DEBAND)
+           || (vppnv.ngxTrueHDR.enable             && filterType == VppType::NGX_TRUEHDR)) {
+            // 現在のパラメータでは何もしないフィルタは除く
+            if (!filterIsIdentity(filterType)) {
+                enabledFilterOrder.push_back(filterType);
+            }
+        }
+    }
+    // 縮小プレビュー時は、先頭で縮小してからフィルタを適用し、末尾で出力サイズに拡大する
+    // (リサイズは末尾の拡大で兼ねる)
+    if (draftEnabled()) {
+        std::vector<VppType> draftFilterOrder;
+        for (const auto filterType : enabledFilterOrder) {
+            if (filterType != VppType::CL_RESIZE) {
+                draftFilterOrder.push_back(filterType);
+            }
+        }
+        if (draftFilterOrder.size() > 0) {
+            draftFilterOrder.insert(draftFilterOrder.begin(), VppType::CL_RESIZE);
+            draftFilterOrder.push_back(VppType::CL_RESIZE);
+            return draftFilterOrder;
+        }
+    }
+    return enabledFilterOrder;
+}
+
+// 縮小プレビューを行うかどうか
+// nnediはフィールド構造が縮小で壊れてしまうので、縮小プレビューの対象外とする
+bool clFilterChainParam::draftEnabled() const {
+    return draftScale > 1 && !vpp.nnedi.enable;
+}
+
+// 縮小プレビュー時に各フィルタの設定に使うパラメータ
+// 画素単位で指定される半径等を縮小率に合わせて小さくし、見た目の効果が大きく変わらないようにする
+clFilterChainParam clFilterChainParam::getDraftParam() const {
+    clFilterChainParam prm = *this;
+    if (!draftEnabled()) {
+        return prm;
+    }
+    const int scale = draftScale;
+    // 奇数で3以上である必要がある
+    auto scaleOddSize = [scale](const int size) {
+        return std::max(3, (size / scale) | 1);
+    };
+    prm.vpp.knn.radius = std::max(1, prm.vpp.knn.radius / scale);
+    prm.vpp.nlmeans.searchSize = scaleOddSize(prm.vpp.nlmeans.searchSize);
+    prm.vpp.nlmeans.patchSize = scaleOddSize(prm.vpp.nlmeans.patchSize);
+    prm.vpp.unsharp.radius = std::max(1, prm.vpp.unsharp.radius / scale);
+    // 0は処理しないという意味なので、0のままとする
+    auto scaleKeepZero = [scale](const int value) {
+        return (value > 0) ? std::max(1, value / scale) : value;
+    };
+    prm.vpp.warpsharp.blur = scaleKeepZero(prm.vpp.warpsharp.blur);
+    prm.vpp.deband.range = scaleKeepZero(prm.vpp.deband.range);
+    // 縮小・拡大は軽量なbilinearで行う
+    prm.vpp.resize_algo = RGY_VPP_RESIZE_BILINEAR;
+    return prm;
+}
+
+// 現在のパラメータで、入力をそのまま出力するだけのフィルタかどうか
+// (フィルタチェーンがすべてこれだと、GPUに転送せずそのまま返せる)
+bool clFilterChainParam::filterIsIdentity(const VppType filterType) const {
+    switch (filterType) {
+    case VppType::CL_COLORSPACE: {
+        if (vpp.colorspace.lut3d.table_file.length() > 0
+            || vpp.colorspace.hdr2sdr.tonemap != HDR2SDR_DISABLED) {
+            return false;
+        }
+        for (const auto& conv : vpp.colorspace.convs) {
+            if (conv.from != conv.to) {
+                return false;
+            }
+        }
+        return true;
+    }
+    case VppType::CL_TWEAK:
+        return !vpp.tweak.yuv_filter_enabled() && !vpp.tweak.rgb_filter_enabled();
+    case VppType::CL_DENOISE_PMD:
+        return vpp.pmd.applyCount <= 0 || vpp.pmd.strength == 0.0f;
+    case VppType::CL_UNSHARP:
+        return vpp.unsharp.weight == 0.0f;
+    case VppType::CL_EDGELEVEL:
+        return vpp.edgelevel.strength == 0.0f;
+    case VppType::CL_WARPSHARP:
+        return vpp.warpsharp.depth == 0.0f;
+    default:
+        return false;
+    }
+}
+
+// フィルタが出力の1画素を計算するのに参照する周辺の画素数
+// 画面全体の統計や画素の位置に依存する乱数を使うなど、一部の領域だけを処理すると結果が変わるフィルタは-1
+int clFilterChainParam::filterHalo(const VppType filterType) const {
+    switch (filterType) {
+    case VppType::CL_COLORSPACE:
+    case VppType::CL_TWEAK:
+        return 0;
+    case VppType::CL_NNEDI:
+        return 24; // nsize 48x6 の半分
+    case VppType::CL_DENOISE_KNN:
+        return vpp.knn.radius;
+    case VppType::CL_DENOISE_NLMEANS:
+        return vpp.nlmeans.searchSize / 2 + vpp.nlmeans.patchSize / 2;
+    case VppType::CL_DENOISE_PMD:
+        return vpp.pmd.applyCount * 3; // 5x5のgauss + 上下左右の参照
+    case VppType::CL_DENOISE_DCT:
+        return vpp.dct.block_size;
+    case VppType::CL_DENOISE_SMOOTH:
+        return 16;
+    case VppType::CL_UNSHARP:
+        return vpp.unsharp.radius;
+    case VppType::CL_EDGELEVEL:
+        return 2;
+    case VppType::CL_WARPSHARP: {
+        const int blur_range = (vpp.warpsharp.type == 0) ? 6 : 2;
+        return 2 + vpp.warpsharp.blur * blur_range + (int)std::ceil(std::abs(vpp.warpsharp.depth)) + 1; // sobel, blur, warp
+    }
+    case VppType::CL_RESIZE: // サンプリング位置がずれるので、領域を切り出して処理できない
+    case VppType::CL_DEBAND:
+    case VppType::CL_LIBPLACEBO_DEBAND:
+    case VppType::CL_LIBPLACEBO_TONEMAP:
+    case VppType::NVVFX_DENOISE:
+    case VppType::NVVFX_ARTIFACT_REDUCTION:
+    case VppType::NGX_TRUEHDR:
+    default:
+        return -1;
+    }
+}
+
+// フィルタチェーン全体で参照する周辺の画素数 (後段のフィルタの参照範囲を前段にさかのぼって加算する)
+// 一部の領域だけを処理できないフィルタを含む場合は-1
+int clFilterChainParam::getChainHalo(const bool resizeRequired) const {
+    int halo = 0;
+    for (const auto filterType : getFilterChain(resizeRequired)) {
+        const int filterHaloSize = filterHalo(filterType);
+        if (filterHaloSize < 0) {
+            return -1;
+        }
+        halo += filterHaloSize;
+    }
+    return halo;
+}
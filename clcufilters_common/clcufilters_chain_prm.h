@@ -1,166 +1,190 @@
-﻿// -----------------------------------------------------------------------------------------
-// clfilters by rigaya
-// -----------------------------------------------------------------------------------------
-//
-// The MIT License
-//
-// Copyright (c) 2024 rigaya
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-// ------------------------------------------------------------------------------------------
-
-#ifndef __CLCUFILTERS_CHAIN_PRM_H__
-#define __CLCUFILTERS_CHAIN_PRM_H__
-
-#include <vector>
-#include <cstdint>
-#include "rgy_osdep.h"
-#include "rgy_tchar.h"
-#include "rgy_log.h"
-#include "rgy_prm.h"
-#include "NVEncFilterParam.h"
-
-static const int SIZE_PIXEL_YC = 6;
-
-static const int FILTER_NAME_MAX_LENGTH = 1024;
-
-#if !CLFILTERS_EN
-static const char *FILTER_NAME_COLORSPACE     = _T("色空間変換");
-static const char *FILTER_NAME_LIBPLACEBO_TONEMAP = _T("トーンマッピング (libplacebo)");
-static const char *FILTER_NAME_NNEDI          = _T("nnedi");
-static const char *FILTER_NAME_NVVFX_DENOISE  = _T("ノイズ除去 (nvvfx-denoise)");
-static const char *FILTER_NAME_NVVFX_ARTIFACT_REDUCTION = _T("ノイズ除去 (nvvfx-artifact-reduction)");
-static const char *FILTER_NAME_DENOISE_KNN    = _T("ノイズ除去 (knn)");
-static const char *FILTER_NAME_DENOISE_NLMEANS = _T("ノイズ除去 (nlmeans)");
-static const char *FILTER_NAME_DENOISE_PMD    = _T("ノイズ除去 (pmd)");
-static const char *FILTER_NAME_DENOISE_DCT    = _T("ノイズ除去 (denoise-dct)");
-static const char *FILTER_NAME_DENOISE_SMOOTH = _T("ノイズ除去 (smooth)");
-static const char *FILTER_NAME_RESIZE         = _T("リサイズ");
-static const char *FILTER_NAME_UNSHARP        = _T("unsharp");
-static const char *FILTER_NAME_EDGELEVEL      = _T("エッジレベル調整");
-static const char *FILTER_NAME_WARPSHARP      = _T("warpsharp");
-static const char *FILTER_NAME_TWEAK          = _T("色調補正");
-static const char *FILTER_NAME_DEBAND         = _T("バンディング低減");
-static const char *FILTER_NAME_LIBPLACEBO_DEBAND = _T("バンディング低減 (libplacebo)");
-static const char *FILTER_NAME_NGX_TRUEHDR    = _T("NGX TrueHDR");
-#else
-static const char *FILTER_NAME_COLORSPACE     = _T("colorspace");
-static const char *FILTER_NAME_LIBPLACEBO_TONEMAP = _T("tonemapping (libplacebo)");
-static const char *FILTER_NAME_NNEDI          = _T("nnedi");
-static const char *FILTER_NAME_NVVFX_DENOISE  = _T("nvvfx-denoise");
-static const char *FILTER_NAME_NVVFX_ARTIFACT_REDUCTION = _T("nvvfx-artifact-reduction");
-static const char *FILTER_NAME_DENOISE_KNN    = _T("knn");
-static const char *FILTER_NAME_DENOISE_NLMEANS = _T("nlmeans");
-static const char *FILTER_NAME_DENOISE_PMD    = _T("pmd");
-static const char *FILTER_NAME_DENOISE_DCT    = _T("denoise-dct");
-static const char *FILTER_NAME_DENOISE_SMOOTH = _T("smooth");
-static const char *FILTER_NAME_RESIZE         = _T("resize");
-static const char *FILTER_NAME_UNSHARP        = _T("unsharp");
-static const char *FILTER_NAME_EDGELEVEL      = _T("edgelevel");
-static const char *FILTER_NAME_WARPSHARP      = _T("warpsharp");
-static const char *FILTER_NAME_TWEAK          = _T("tweak");
-static const char *FILTER_NAME_DEBAND         = _T("deband");
-static const char *FILTER_NAME_LIBPLACEBO_DEBAND = _T("deband (libplacebo)");
-static const char *FILTER_NAME_NGX_TRUEHDR    = _T("NGX TrueHDR");
-#endif
-
-#define FILTER_NAME(x) std::make_pair(FILTER_NAME_ ## x, VppType::CL_ ## x)
-#define FILTER_NAME_NVVFX(x) std::make_pair(FILTER_NAME_NVVFX_ ## x, VppType::NVVFX_ ## x)
-#define FILTER_NAME_NGX(x) std::make_pair(FILTER_NAME_NGX_ ## x, VppType::NGX_ ## x)
-
-static const auto filterList = make_array<std::pair<const TCHAR*, VppType>>(
-    FILTER_NAME(COLORSPACE),
-    FILTER_NAME(LIBPLACEBO_TONEMAP),
-    FILTER_NAME(NNEDI),
-    FILTER_NAME_NVVFX(DENOISE),
-    FILTER_NAME_NVVFX(ARTIFACT_REDUCTION),
-    FILTER_NAME(DENOISE_KNN),
-    FILTER_NAME(DENOISE_NLMEANS),
-    FILTER_NAME(DENOISE_PMD),
-    FILTER_NAME(DENOISE_DCT),
-    FILTER_NAME(DENOISE_SMOOTH),
-    FILTER_NAME(RESIZE),
-    FILTER_NAME(UNSHARP),
-    FILTER_NAME(EDGELEVEL),
-    FILTER_NAME(WARPSHARP),
-    FILTER_NAME(TWEAK),
-    FILTER_NAME(DEBAND),
-    FILTER_NAME(LIBPLACEBO_DEBAND),
-    FILTER_NAME_NGX(TRUEHDR)
-);
-
-#undef FILTER_NAME
-
-struct AviutlAufExeParams {
-    RGYParamLogLevel log_level;
-    tstring logfile;
-    bool noNVCL;
-    bool clinfo;
-    bool checkDevice;
-    uint32_t ppid;
-    int max_w;
-    int max_h;
-    int sizeSharedPrm; // sizeof(clfitersSharedPrms)
-    int sizeSharedMesData; // sizeof(clfitersSharedMesData)
-    int sizePIXELYC; //sizeof(PIXEL_YC)
-    HANDLE eventMesStart;
-    HANDLE eventMesEnd;
-
-    AviutlAufExeParams();
-    ~AviutlAufExeParams();
-};
-
-static const int16_t CLCU_PLATFORM_CUDA = -1;
-
-union CL_PLATFORM_DEVICE {
-    struct {
-        int16_t platform;
-        int16_t device;
-    } s;
-    int i;
-};
-
-static bool platformIsCUDA(int16_t platform) {
-    return platform == CLCU_PLATFORM_CUDA;
-}
-
-// 保存モード(is_saving=true)の時に、どのくらい先まで処理をしておくべきか?
-static const int frameInOffset = 2;
-static const int frameProcOffset = 1;
-static const int frameOutOffset = 0;
-
-struct clFilterChainParam {
-    HMODULE hModule;
-    RGYParamVpp vpp;
-    VppParam vppnv;
-    RGYParamLogLevel log_level;
-    bool log_to_file;
-    int outWidth;
-    int outHeight;
-
-    clFilterChainParam();
-    bool operator==(const clFilterChainParam &x) const;
-    bool operator!=(const clFilterChainParam &x) const;
-    std::vector<VppType> getFilterChain(const bool resizeRequired) const;
-    tstring genCmd() const;
-    void setPrmFromCmd(const tstring& cmd);
-};
-
-#endif //__CLCUFILTERS_CHAIN_PRM_H__
+﻿// -----------------------------------------------------------------------------------------
+// clfilters by rigaya
+// -----------------------------------------------------------------------------------------
+//
+// The MIT License
+//
+// Copyright (c) 2024 rigaya
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// ------------------------------------------------------------------------------------------
+
+#ifndef __CLCUFILTERS_CHAIN_PRM_H__
+#define __CLCUFILTERS_CHAIN_PRM_H__
+
+#include <vector>
+#include <cstdint>
+#include "rgy_osdep.h"
+#include "rgy_tchar.h"
+#include "rgy_log.h"
+#include "rgy_prm.h"
+#include "NVEncFilterParam.h"
+
+static const int SIZE_PIXEL_YC = 6;
+
+static const int FILTER_NAME_MAX_LENGTH = 1024;
+
+#if !CLFILTERS_EN
+static const char *FILTER_NAME_COLORSPACE     = _T("色空間変換");
+static const char *FILTER_NAME_LIBPLACEBO_TONEMAP = _T("トーンマッピング (libplacebo)");
+static const char *FILTER_NAME_NNEDI          = _T("nnedi");
+static const char *FILTER_NAME_NVVFX_DENOISE  = _T("ノイズ除去 (nvvfx-denoise)");
+static const char *FILTER_NAME_NVVFX_ARTIFACT_REDUCTION = _T("ノイズ除去 (nvvfx-artifact-reduction)");
+static const char *FILTER_NAME_DENOISE_KNN    = _T("ノイズ除去 (knn)");
+static const char *FILTER_NAME_DENOISE_NLMEANS = _T("ノイズ除去 (nlmeans)");
+static const char *FILTER_NAME_DENOISE_PMD    = _T("ノイズ除去 (pmd)");
+static const char *FILTER_NAME_DENOISE_DCT    = _T("ノイズ除去 (denoise-dct)");
+static const char *FILTER_NAME_DENOISE_SMOOTH = _T("ノイズ除去 (smooth)");
+static const char *FILTER_NAME_RESIZE         = _T("リサイズ");
+static const char *FILTER_NAME_UNSHARP        = _T("unsharp");
+static const char *FILTER_NAME_EDGELEVEL      = _T("エッジレベル調整");
+static const char *FILTER_NAME_WARPSHARP      = _T("warpsharp");
+static const char *FILTER_NAME_TWEAK          = _T("色調補正");
+static const char *FILTER_NAME_DEBAND         = _T("バンディング低減");
+static const char *FILTER_NAME_LIBPLACEBO_DEBAND = _T("バンディング低減 (libplacebo)");
+static const char *FILTER_NAME_NGX_TRUEHDR    = _T("NGX TrueHDR");
+#else
+static const char *FILTER_NAME_COLORSPACE     = _T("colorspace");
+static const char *FILTER_NAME_LIBPLACEBO_TONEMAP = _T("tonemapping (libplacebo)");
+static const char *FILTER_NAME_NNEDI          = _T("nnedi");
+static const char *FILTER_NAME_NVVFX_DENOISE  = _T("nvvfx-denoise");
+static const char *FILTER_NAME_NVVFX_ARTIFACT_REDUCTION = _T("nvvfx-artifact-reduction");
+static const char *FILTER_NAME_DENOISE_KNN    = _T("knn");
+static const char *FILTER_NAME_DENOISE_NLMEANS = _T("nlmeans");
+static const char *FILTER_NAME_DENOISE_PMD    = _T("pmd");
+static const char *FILTER_NAME_DENOISE_DCT    = _T("denoise-dct");
+static const char *FILTER_NAME_DENOISE_SMOOTH = _T("smooth");
+static const char *FILTER_NAME_RESIZE         = _T("resize");
+static const char *FILTER_NAME_UNSHARP        = _T("unsharp");
+static const char *FILTER_NAME_EDGELEVEL      = _T("edgelevel");
+static const char *FILTER_NAME_WARPSHARP      = _T("warpsharp");
+static const char *FILTER_NAME_TWEAK          = _T("tweak");
+static const char *FILTER_NAME_DEBAND         = _T("deband");
+static const char *FILTER_NAME_LIBPLACEBO_DEBAND = _T("deband (libplacebo)");
+static const char *FILTER_NAME_NGX_TRUEHDR    = _T("NGX TrueHDR");
+#endif
+
+#define FILTER_NAME(x) std::make_pair(FILTER_NAME_ ## x, VppType::CL_ ## x)
+#define FILTER_NAME_NVVFX(x) std::make_pair(FILTER_NAME_NVVFX_ ## x, VppType::NVVFX_ ## x)
+#define FILTER_NAME_NGX(x) std::make_pair(FILTER_NAME_NGX_ ## x, VppType::NGX_ ## x)
+
+static const auto filterList = make_array<std::pair<const TCHAR*, VppType>>(
+    FILTER_NAME(COLORSPACE),
+    FILTER_NAME(LIBPLACEBO_TONEMAP),
+    FILTER_NAME(NNEDI),
+    FILTER_NAME_NVVFX(DENOISE),
+    FILTER_NAME_NVVFX(ARTIFACT_REDUCTION),
+    FILTER_NAME(DENOISE_KNN),
+    FILTER_NAME(DENOISE_NLMEANS),
+    FILTER_NAME(DENOISE_PMD),
+    FILTER_NAME(DENOISE_DCT),
+    FILTER_NAME(DENOISE_SMOOTH),
+    FILTER_NAME(RESIZE),
+    FILTER_NAME(UNSHARP),
+    FILTER_NAME(EDGELEVEL),
+    FILTER_NAME(WARPSHARP),
+    FILTER_NAME(TWEAK),
+    FILTER_NAME(DEBAND),
+    FILTER_NAME(LIBPLACEBO_DEBAND),
+    FILTER_NAME_NGX(TRUEHDR)
+);
+
+#undef FILTER_NAME
+
+enum CLCU_CHAIN_FP16 {
+    CLCU_CHAIN_FP16_OFF = 0,
+    CLCU_CHAIN_FP16_ON,
+    CLCU_CHAIN_FP16_REPORT, // 有効にしたうえで、パラメータの変更ごとに16bit整数での処理結果との差を出力する (時間方向のフィルタの次のフレームの出力が変わるので、確認用)
+};
+
+struct AviutlAufExeParams {
+    RGYParamLogLevel log_level;
+    tstring logfile;
+    bool noNVCL;
+    bool clinfo;
+    bool checkDevice;
+    bool checkConvertCsp; // 色空間変換関数の動作確認と速度計測を行う
+    bool benchLaunch;     // OpenCLのカーネル起動のオーバーヘッドを計測する (引数のキャッシュの有無で比較)
+    uint32_t ppid;
+    int max_w;
+    int max_h;
+    int sizeSharedPrm; // sizeof(clfitersSharedPrms)
+    int sizeSharedMesData; // sizeof(clfitersSharedMesData)
+    int sizePIXELYC; //sizeof(PIXEL_YC)
+    int cacheHostMB; // 出力フレームのキャッシュ(CPUメモリ)の上限 (MB, 0で無効(既定), aviutl.iniのclfilter_cache_host_mbで指定)
+    int colorspaceLUTBake; // colorspaceの変換処理を3D LUTに焼き込む際のLUTのサイズ (0:無効(既定), -1:自動)
+    int cspThreads;        // 色空間変換のスレッド数 (転送用/取得用のそれぞれ, 0:自動)
+    RGYParamThread cspThreadParam; // 色空間変換のスレッドのaffinity/優先度
+    bool pipelineThread;   // 保存モードで、次のフレームの取得/処理の投入をAviUtl側の処理中に先行して行う
+    bool launchReplay;     // フィルタチェーンのカーネル起動を記録し、パラメータが変わらない間は再実行する (OpenCLのみ, 既定では無効)
+    bool frameArena;       // フィルタ内部のフレームをまとめて確保したデバイスメモリから切り出す (OpenCLのみ)
+    bool transferStaging;  // 入出力フレームをデバイスメモリに置き、ステージングバッファ経由で転送する (OpenCLのみ)
+    CLCU_CHAIN_FP16 chainFp16; // fp16の演算に対応したフィルタを、チェーン全体でfp16で処理する (OpenCLのみ)
+    bool workSizeTune;     // カーネルのローカルワークサイズ等を実際のフレーム処理で計測して選択する (OpenCLのみ, 既定では無効, aviutl.iniのclfilter_worksize_tuneで指定)
+    HANDLE eventMesStart;
+    HANDLE eventMesEnd;
+
+    AviutlAufExeParams();
+    ~AviutlAufExeParams();
+};
+
+static const int16_t CLCU_PLATFORM_CUDA = -1;
+
+union CL_PLATFORM_DEVICE {
+    struct {
+        int16_t platform;
+        int16_t device;
+    } s;
+    int i;
+};
+
+static bool platformIsCUDA(int16_t platform) {
+    return platform == CLCU_PLATFORM_CUDA;
+}
+
+// 保存モード(is_saving=true)の時に、どのくらい先まで処理をしておくべきか?
+static const int frameInOffset = 2;
+static const int frameProcOffset = 1;
+static const int frameOutOffset = 0;
+
+struct clFilterChainParam {
+    HMODULE hModule;
+    RGYParamVpp vpp;
+    VppParam vppnv;
+    RGYParamLogLevel log_level;
+    bool log_to_file;
+    int outWidth;
+    int outHeight;
+    int draftScale; // プレビュー時に縮小して処理する場合の縮小率 (1/draftScale, 0で無効)
+
+    clFilterChainParam();
+    bool operator==(const clFilterChainParam &x) const;
+    bool operator!=(const clFilterChainParam &x) const;
+    std::vector<VppType> getFilterChain(const bool resizeRequired) const;
+    bool filterIsIdentity(const VppType filterType) const;
+    int filterHalo(const VppType filterType) const;
+    int getChainHalo(const bool resizeRequired) const;
+    bool draftEnabled() const;
+    clFilterChainParam getDraftParam() const;
+    tstring genCmd() const;
+    void setPrmFromCmd(const tstring& cmd);
+};
+
+#endif //__CLCUFILTERS_CHAIN_PRM_H__
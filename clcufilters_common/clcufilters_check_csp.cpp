@@ -0,0 +1,281 @@
+﻿// -----------------------------------------------------------------------------------------
+// clfilters by rigaya
+// -----------------------------------------------------------------------------------------
+//
+// The MIT License
+//
+// Copyright (c) 2022 rigaya
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// ------------------------------------------------------------------------------------------
+
+#include <cstring>
+#include <chrono>
+#include <random>
+#include <map>
+#include <tuple>
+#include "rgy_osdep.h"
+#include "rgy_util.h"
+#include "rgy_frame_info.h"
+#include "convert_csp.h"
+#include "clcufilters_check_csp.h"
+
+static const int CHECK_CSP_PLANES = 4;
+static const int CHECK_CSP_PAD = 256; // SIMD版の行末の書き込みのはみ出しを許容するための余白
+
+// 変換関数に渡すバッファ
+// 色空間によらず扱えるよう、各planeを1画素8byteとしてwidth x heightずつ確保する
+class clcuCheckCspFrame {
+public:
+    clcuCheckCspFrame(const int width, const int height) :
+        m_pitch(ALIGN(width * 8, 64) + CHECK_CSP_PAD),
+        m_height(height),
+        m_buf((uint8_t *)_aligned_malloc(size(), 64)) {
+    }
+    size_t size() const { return (size_t)m_pitch * m_height * CHECK_CSP_PLANES; }
+    int pitch() const { return m_pitch; }
+    int height() const { return m_height; }
+    uint8_t *data() { return m_buf.get(); }
+    const uint8_t *data() const { return m_buf.get(); }
+    uint8_t *plane(const int i) { return m_buf.get() + (size_t)m_pitch * m_height * i; }
+    void fill(const uint8_t val) { memset(m_buf.get(), val, size()); }
+protected:
+    int m_pitch;
+    int m_height;
+    std::unique_ptr<uint8_t, aligned_malloc_deleter> m_buf;
+};
+
+// 入力を乱数で埋める (YC48等は変換関数の想定する値域に収める)
+static void fill_random(clcuCheckCspFrame& frame, const RGY_CSP csp, std::mt19937& mt) {
+    const int rows = frame.height() * CHECK_CSP_PLANES;
+    if (csp == RGY_CSP_YC48) {
+        std::uniform_int_distribution<int> distY(-299, 4470), distC(-2350, 2350);
+        for (int y = 0; y < rows; y++) {
+            int16_t *ptr = (int16_t *)(frame.data() + (size_t)frame.pitch() * y);
+            for (int x = 0; x + 3 <= frame.pitch() / (int)sizeof(int16_t); x += 3) {
+                ptr[x+0] = (int16_t)distY(mt);
+                ptr[x+1] = (int16_t)distC(mt);
+                ptr[x+2] = (int16_t)distC(mt);
+            }
+        }
+    } else if (RGY_CSP_BIT_DEPTH[csp] > 8) {
+        const int bitdepth = std::min<int>(RGY_CSP_BIT_DEPTH[csp], 16);
+        const int shift = (csp == RGY_CSP_P010 || csp == RGY_CSP_P210) ? 16 - bitdepth : 0;
+        std::uniform_int_distribution<int> dist(0, (1 << bitdepth) - 1);
+        uint16_t *ptr = (uint16_t *)frame.data();
+        for (size_t i = 0; i < frame.size() / sizeof(uint16_t); i++) {
+            ptr[i] = (uint16_t)(dist(mt) << shift);
+        }
+    } else {
+        std::uniform_int_distribution<int> dist(0, 255);
+        uint8_t *ptr = frame.data();
+        for (size_t i = 0; i < frame.size(); i++) {
+            ptr[i] = (uint8_t)dist(mt);
+        }
+    }
+}
+
+// 1フレームの有効なデータ量 (byte)
+static size_t frame_bytes(const RGY_CSP csp, const int width, const int height) {
+    const RGYFrameInfo frame(width, height, csp, RGY_CSP_BIT_DEPTH[csp]);
+    size_t bytes = 0;
+    for (int i = 0; i < RGY_CSP_PLANES[csp]; i++) {
+        const auto plane = getPlane(&frame, (RGY_PLANE)i);
+        bytes += (size_t)plane.width * bytesPerPix(csp) * plane.height;
+    }
+    return bytes;
+}
+
+static void run_convert(funcConvertCSP func, clcuCheckCspFrame& dst, clcuCheckCspFrame& src, const int width, const int height, int *crop, const int thread_n) {
+    void *dstPtr[CHECK_CSP_PLANES];
+    const void *srcPtr[CHECK_CSP_PLANES];
+    for (int i = 0; i < CHECK_CSP_PLANES; i++) {
+        dstPtr[i] = dst.plane(i);
+        srcPtr[i] = src.plane(i);
+    }
+    const int dst_height = height - crop[1] - crop[3];
+    for (int ith = 0; ith < thread_n; ith++) {
+        func(dstPtr, srcPtr, width, src.pitch(), src.pitch(), dst.pitch(), height, dst_height, ith, thread_n, crop);
+    }
+}
+
+// 出力の各planeの有効な範囲のうち、基準の関数が書き込んだ位置(0x00埋めと0xFF埋めで結果が一致した位置)のみ比較し、
+// 一致しないbyte数を返す (行末を超えた書き込みはSIMD版ごとに異なるので比較しない)
+static size_t count_mismatch(const clcuCheckCspFrame& test, const clcuCheckCspFrame& refA, const clcuCheckCspFrame& refB, const RGY_CSP csp, const int width, const int height) {
+    const RGYFrameInfo frame(width, height, csp, RGY_CSP_BIT_DEPTH[csp]);
+    size_t mismatch = 0;
+    for (int i = 0; i < std::min<int>(RGY_CSP_PLANES[csp], CHECK_CSP_PLANES); i++) {
+        const auto plane = getPlane(&frame, (RGY_PLANE)i);
+        const int rowBytes = std::min(plane.width * bytesPerPix(csp), test.pitch());
+        for (int y = 0; y < std::min(plane.height, test.height()); y++) {
+            const size_t offset = (size_t)test.pitch() * test.height() * i + (size_t)test.pitch() * y;
+            const uint8_t *t = test.data() + offset;
+            const uint8_t *a = refA.data() + offset;
+            const uint8_t *b = refB.data() + offset;
+            for (int x = 0; x < rowBytes; x++) {
+                if (a[x] == b[x] && t[x] != a[x]) {
+                    mismatch++;
+                }
+            }
+        }
+    }
+    return mismatch;
+}
+
+struct clcuCheckCspCase {
+    int width, height;
+    int crop[4]; // left, up, right, bottom
+    bool interlaced;
+};
+
+// 出力の一致の確認、一致しないbyte数を返す
+static size_t check_convert(const ConvertCSP *test, const ConvertCSP *ref, tstring& detail) {
+    static const int widths[] = { 16, 37, 723, 1283 };
+    static const int crops[][4] = { { 0, 0, 0, 0 }, { 4, 4, 2, 8 } };
+    static const int threads[] = { 1, 3 };
+    const int height = 72;
+    std::mt19937 mt(1234);
+    size_t mismatch = 0;
+    for (const auto width : widths) {
+        for (const auto& crop : crops) {
+            if (width <= crop[0] + crop[2] + 4) continue;
+            for (int interlaced = 0; interlaced < 2; interlaced++) {
+                clcuCheckCspCase tc = { width, height, { crop[0], crop[1], crop[2], crop[3] }, interlaced != 0 };
+                // 出力の各planeは dst[0] + pitch * dst_height * i に置く (C版の関数はこの配置を前提とするものがある)
+                const int dstWidth = width - crop[0] - crop[2];
+                const int dstHeight = height - crop[1] - crop[3];
+                clcuCheckCspFrame src(width, height), refA(width, dstHeight), refB(width, dstHeight), dst(width, dstHeight);
+                fill_random(src, test->csp_from, mt);
+                refA.fill(0x00);
+                refB.fill(0xff);
+                run_convert(ref->func[tc.interlaced], refA, src, tc.width, tc.height, tc.crop, 1);
+                run_convert(ref->func[tc.interlaced], refB, src, tc.width, tc.height, tc.crop, 1);
+                for (const auto thread_n : threads) {
+                    dst.fill(0x00);
+                    run_convert(test->func[tc.interlaced], dst, src, tc.width, tc.height, tc.crop, thread_n);
+                    const auto count = count_mismatch(dst, refA, refB, test->csp_to, dstWidth, dstHeight);
+                    if (count > 0 && detail.length() == 0) {
+                        detail = strsprintf(_T("%dx%d%s, crop %d,%d,%d,%d, %d thread(s): %llu bytes differ"),
+                            tc.width, tc.height, tc.interlaced ? _T("i") : _T("p"),
+                            tc.crop[0], tc.crop[1], tc.crop[2], tc.crop[3], thread_n, (unsigned long long)count);
+                    }
+                    mismatch += count;
+                }
+            }
+        }
+    }
+    return mismatch;
+}
+
+// 1フレームあたりの処理時間(ms)、他の処理の影響を避けるため最小値をとる
+static double bench_convert(const ConvertCSP *test, clcuCheckCspFrame& dst, clcuCheckCspFrame& src, const int width, const int height) {
+    int crop[4] = { 0 };
+    run_convert(test->func[0], dst, src, width, height, crop, 1);
+    int runs = 0;
+    double total = 0.0, fastest = 0.0;
+    do {
+        const auto start = std::chrono::high_resolution_clock::now();
+        run_convert(test->func[0], dst, src, width, height, crop, 1);
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        fastest = (runs == 0) ? ms : std::min(fastest, ms);
+        total += ms;
+        runs++;
+    } while (runs < 5 || total < 100.0);
+    return fastest;
+}
+
+static const TCHAR *simd_name(const RGY_SIMD simd) {
+    return (simd == RGY_SIMD::NONE) ? _T("C") : get_simd_str(simd);
+}
+
+int clcuCheckConvertCSP(tstring& result) {
+    const int benchWidth = 1920, benchHeight = 1080;
+    const auto availableSIMD = get_availableSIMD();
+    result = strsprintf(_T("convert_csp check: cpu %s, bench %dx%d, 1 thread\n"), get_simd_str(availableSIMD), benchWidth, benchHeight);
+
+    // 変換元, 変換先, uv_onlyごとにまとめる (テーブル内の順序 = 優先順位を維持する)
+    std::vector<std::tuple<RGY_CSP, RGY_CSP, bool>> groupOrder;
+    std::map<std::tuple<RGY_CSP, RGY_CSP, bool>, std::vector<const ConvertCSP *>> groups;
+    for (const auto func : get_convert_csp_func_list()) {
+        const auto key = std::make_tuple(func->csp_from, func->csp_to, func->uv_only);
+        if (groups.count(key) == 0) {
+            groupOrder.push_back(key);
+        }
+        groups[key].push_back(func);
+    }
+
+    int errCount = 0;
+    for (const auto& key : groupOrder) {
+        const auto& funcs = groups[key];
+        // 基準はC版、なければテーブルの最後(最も低いSIMD)の関数
+        const ConvertCSP *ref = funcs.back();
+        for (const auto func : funcs) {
+            if (func->simd == RGY_SIMD::NONE) {
+                ref = func;
+                break;
+            }
+        }
+        const auto selected = get_convert_csp_func(std::get<0>(key), std::get<1>(key), std::get<2>(key), RGY_SIMD::SIMD_ALL);
+        result += strsprintf(_T("%s -> %s%s\n"), RGY_CSP_NAMES[std::get<0>(key)], RGY_CSP_NAMES[std::get<1>(key)], std::get<2>(key) ? _T(" (uv only)") : _T(""));
+        if ((ref->simd & availableSIMD) != ref->simd) {
+            result += strsprintf(_T("  reference (%s) not supported on this cpu, skipped.\n"), simd_name(ref->simd));
+            continue;
+        }
+
+        clcuCheckCspFrame src(benchWidth, benchHeight), dst(benchWidth, benchHeight);
+        std::mt19937 mt(5678);
+        fill_random(src, std::get<0>(key), mt);
+        const auto bytes = frame_bytes(std::get<0>(key), benchWidth, benchHeight) + frame_bytes(std::get<1>(key), benchWidth, benchHeight);
+        double selectedMs = 0.0, fastestMs = 0.0;
+        const ConvertCSP *fastest = nullptr;
+        for (const auto func : funcs) {
+            if ((func->simd & availableSIMD) != func->simd) {
+                result += strsprintf(_T("  %-8s : not supported\n"), simd_name(func->simd));
+                continue;
+            }
+            tstring detail;
+            const auto mismatch = (func == ref) ? 0 : check_convert(func, ref, detail);
+            const auto ms = bench_convert(func, dst, src, benchWidth, benchHeight);
+            if (mismatch > 0) {
+                errCount++;
+            }
+            if (func == selected) {
+                selectedMs = ms;
+            }
+            // 結果の一致しない関数は、選択されるべき候補にしない
+            if (mismatch == 0 && (fastest == nullptr || ms < fastestMs)) {
+                fastest = func;
+                fastestMs = ms;
+            }
+            result += strsprintf(_T("  %-8s : %-6s %7.3f ms, %6.2f GB/s%s\n"),
+                simd_name(func->simd), (func == ref) ? _T("ref") : ((mismatch > 0) ? _T("NG") : _T("OK")),
+                ms, bytes / (ms * 1e-3) * 1e-9, (func == selected) ? _T(" (selected)") : _T(""));
+            if (detail.length() > 0) {
+                result += _T("             ") + detail + _T("\n");
+            }
+        }
+        // 選択される関数が明らかに遅い場合は、テーブルの優先順位の誤りの可能性がある
+        if (selected && fastest && fastest != selected && fastestMs * 1.1 < selectedMs) {
+            result += strsprintf(_T("  warning: selected %s is slower than %s.\n"), simd_name(selected->simd), simd_name(fastest->simd));
+        }
+    }
+    result += (errCount > 0) ? strsprintf(_T("%d function(s) do not match the reference.\n"), errCount) : tstring(_T("all functions match the reference.\n"));
+    return errCount;
+}
@@ -1,248 +1,456 @@
-﻿// -----------------------------------------------------------------------------------------
-// clfilters by rigaya
-// -----------------------------------------------------------------------------------------
-//
-// The MIT License
-//
-// Copyright (c) 2024 rigaya
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-// ------------------------------------------------------------------------------------------
-
-#include "clcufilters_exe.h"
-
-clcuFiltersExe::clcuFiltersExe() :
-    m_filter(),
-    m_aviutlHandle(),
-    m_eventMesStart(nullptr),
-    m_eventMesEnd(nullptr),
-    m_sharedMessage(),
-    m_sharedPrms(),
-    m_sharedFrames(),
-    m_ppid(0),
-    m_maxWidth(0),
-    m_maxHeight(0),
-    m_pitchBytes(0),
-    m_log() { }
-clcuFiltersExe::~clcuFiltersExe() {
-    for (auto& f : m_sharedFrames) {
-        f.reset();
-    }
-}
-
-int clcuFiltersExe::init(AviutlAufExeParams& prms) {
-    m_eventMesStart = prms.eventMesStart;
-    m_eventMesEnd = prms.eventMesEnd;
-    if (!m_eventMesStart || !m_eventMesEnd) {
-        AddMessage(RGY_LOG_ERROR, _T("Invalid event handles."));
-        return 1;
-    }
-    WaitForSingleObject(m_eventMesStart, INFINITE);
-    m_log = std::make_shared<RGYLog>(prms.logfile.c_str(), prms.log_level, false, true);
-
-    m_ppid = prms.ppid;
-    m_aviutlHandle = std::unique_ptr<std::remove_pointer<HANDLE>::type, handle_deleter>(OpenProcess(SYNCHRONIZE | PROCESS_VM_READ, FALSE, prms.ppid), handle_deleter());
-    if (!m_aviutlHandle) {
-        AddMessage(RGY_LOG_ERROR, _T("Failed to open Aviutl process handle %d.\n"), prms.ppid);
-        return 1;
-    }
-    AddMessage(RGY_LOG_DEBUG, _T("Opened Aviutl process handle %d.\n"), prms.ppid);
-
-    m_sharedMessage = std::make_unique<RGYSharedMemWin>(strsprintf(CLFILTER_SHARED_MEM_MESSAGE, prms.ppid).c_str(), sizeof(clfitersSharedMesData));
-    if (!m_sharedMessage || !m_sharedMessage->is_open()) {
-        AddMessage(RGY_LOG_ERROR, _T("Failed to open shared mem for messages.\n"));
-        m_sharedMessage.reset();
-        return 1;
-    }
-    AddMessage(RGY_LOG_DEBUG, _T("Opened shared mem for messages.\n"));
-
-    m_sharedPrms = std::make_unique<RGYSharedMemWin>(strsprintf(CLFILTER_SHARED_MEM_PRMS, prms.ppid).c_str(), sizeof(clfitersSharedPrms));
-    if (!m_sharedPrms || !m_sharedPrms->is_open()) {
-        AddMessage(RGY_LOG_ERROR, _T("Failed to open shared mem for parameters.\n"));
-        m_sharedPrms.reset();
-        return 1;
-    }
-    AddMessage(RGY_LOG_DEBUG, _T("Opened shared mem for parameters.\n"));
-
-    m_maxWidth = prms.max_w;
-    m_maxHeight = prms.max_h;
-    m_pitchBytes = get_shared_frame_pitch(m_maxWidth);
-    const int frameSize = m_pitchBytes * m_maxHeight;
-    AddMessage(RGY_LOG_DEBUG, _T("Frame max %dx%d, pitch %d, size %d.\n"), m_maxWidth, m_maxHeight, m_pitchBytes, frameSize);
-
-    for (size_t i = 0; i < m_sharedFrames.size(); i++) {
-        m_sharedFrames[i] = std::make_unique<RGYSharedMemWin>(strsprintf(CLFILTER_SHARED_MEM_FRAMES, m_ppid, i).c_str(), frameSize);
-        if (!m_sharedFrames[i] || !m_sharedFrames[i]->is_open()) {
-            AddMessage(RGY_LOG_ERROR, _T("Failed to open shared mem for frame(%d).\n"), i);
-            return 1;
-        }
-        AddMessage(RGY_LOG_DEBUG, _T("Opened shared mem for frame(%d).\n"), i);
-    }
-
-    //デバッグ用
-
-    initDevices();
-    // プロセス初期化処理の終了を通知
-    SetEvent(m_eventMesEnd);
-    return 0;
-}
-
-RGYFrameInfo clcuFiltersExe::setFrameInfo(const int iframeID, const int width, const int height, void *frame) {
-    RGYFrameInfo in;
-    //入力フレーム情報
-    in.width = width;
-    in.height = height;
-    in.pitch[0] = m_pitchBytes;
-    in.csp = RGY_CSP_YC48;
-    in.picstruct = RGY_PICSTRUCT_FRAME;
-    in.ptr[0] = (uint8_t *)frame;
-    in.mem_type = RGY_MEM_TYPE_CPU;
-    in.inputFrameId = iframeID;
-    return in;
-}
-
-int clcuFiltersExe::funcProc() {
-    // エラーメッセージ用の領域を初期化
-    getMessagePtr()->data[0] = '\0';
-
-    clFilterChainParam prm;
-    auto sharedPrms = (clfitersSharedPrms *)m_sharedPrms->ptr();
-    const auto dev_pd = sharedPrms->pd;
-    const auto current_frame = sharedPrms->currentFrameId;
-    const auto frame_n = sharedPrms->frame_n;
-    const auto resetPipeline = sharedPrms->resetPipeLine;
-    auto is_saving = sharedPrms->is_saving;
-    // どのフレームから処理を開始すべきか?
-    auto frameIn = sharedPrms->frameIn;
-    const auto frameInFin = sharedPrms->frameInFin;
-    auto frameProc = sharedPrms->frameProc;
-    //auto frameOut = sharedPrms->frameOut;
-    prm.setPrmFromCmd(char_to_tstring(sharedPrms->prms));
-    if (!m_filter
-        || m_filter->platformID() != dev_pd.s.platform
-        || m_filter->deviceID() != dev_pd.s.device) {
-        int ret = 0;
-        std::string mes = AUF_FULL_NAME;
-        mes += ": ";
-        auto sts = initDevice(sharedPrms, prm);
-        if (sts != RGY_ERR_NONE) {
-            mes += LB_WND_OPENCL_UNAVAIL;
-            getMessagePtr()->ret = ret;
-            strcpy_s(getMessagePtr()->data, mes.c_str());
-            return sts;
-        }
-    }
-
-    // 保存モード(is_saving=true)の時に、どのくらい先まで処理をしておくべきか?
-    static_assert(frameInOffset < clcuFilterFrameBuffer::bufSize);
-    static_assert(frameInOffset < _countof(clfitersSharedPrms::srcFrame));
-    if (resetPipeline
-        || m_filter->getNextOutFrameId() != current_frame) { // 出てくる予定のフレームがずれていたらリセット
-        m_filter->resetPipeline();
-    }
-    m_log->write(RGY_LOG_TRACE, RGY_LOGT_CORE, "exe:   start get frame In: %d -> %d\n", frameIn, frameInFin);
-
-    // -- フレームの転送 -----------------------------------------------------------------
-    // frameIn の終了フレーム
-    //const int frameInFin = (is_saving) ? std::min(current_frame + frameInOffset, frame_n - 1) : current_frame;
-    // フレーム転送の実行
-    auto sts = RGY_ERR_NONE;
-    for (int i = 0; frameIn <= frameInFin; frameIn++, i++) {
-        if (i > 0) {
-            // 2フレーム目以降は、プラグイン側の処理完了を待つ必要がある
-            while (WaitForSingleObject(m_eventMesStart, 100) == WAIT_TIMEOUT) {
-                // Aviutl側が終了していたら終了
-                if (m_aviutlHandle && WaitForSingleObject(m_aviutlHandle.get(), 0) != WAIT_TIMEOUT) {
-                    return FALSE;
-                }
-            }
-        }
-        const auto& srcFrame = sharedPrms->srcFrame[i];
-        const RGYFrameInfo in = setFrameInfo(frameIn, srcFrame.width, srcFrame.height, m_sharedFrames[current_frame % m_sharedFrames.size()]->ptr());
-        // 受け取り中のエラーは保持するが、まずは最後まで受け取ることを優先する
-        if (sts == RGY_ERR_NONE) {
-            // 成功していた場合のみGPUに転送する
-            sts = m_filter->sendInFrame(&in);
-            m_log->write(RGY_LOG_TRACE, RGY_LOGT_CORE, "exe:   get frame In: srcFrame[%d]=%d - m_sharedFrames[%d]\n", i, srcFrame.frameId, current_frame % m_sharedFrames.size());
-        }
-        if (frameIn < frameInFin) {
-            // まだ受け取るフレームがあるなら、GPUへの転送完了を通知
-            SetEvent(m_eventMesEnd);
-        } 
-    }
-    if (sts != RGY_ERR_NONE) {
-        return sts;
-    }
-    if (frame_n <= 0 || current_frame < 0) {
-        return TRUE; // 何もしない
-    }
-    // -- フレームの処理 -----------------------------------------------------------------
-    if (prm != m_filter->getPrm()) { // パラメータが変更されていたら、
-        frameProc = current_frame;   // 現在のフレームから処理をやり直す
-    }
-    // frameProc の終了フレーム
-    const int frameProcFin = (is_saving) ? std::min(current_frame + frameProcOffset, frame_n - 1) : current_frame;
-    // フレーム処理の実行
-    for (; frameProc <= frameProcFin; frameProc++) {
-        m_log->write(RGY_LOG_TRACE, RGY_LOGT_CORE, "exe:   filter proc: %d\n", frameProc);
-        if (m_filter->proc(frameProc, prm) != RGY_ERR_NONE) {
-            return FALSE;
-        }
-    }
-    // -- フレームの取得 -----------------------------------------------------------------
-    RGYFrameInfo out = setFrameInfo(current_frame, prm.outWidth, prm.outHeight, m_sharedFrames[(current_frame + 1) % m_sharedFrames.size()]->ptr());
-    if (m_filter->getOutFrame(&out) != RGY_ERR_NONE) {
-        return FALSE;
-    }
-    m_log->write(RGY_LOG_TRACE, RGY_LOGT_CORE, "exe:   set frame out: m_sharedFrames[%d] -> %d, NextOutFrameId %d\n", (current_frame + 1) % m_sharedFrames.size(), current_frame, m_filter->getNextOutFrameId());
-    // 本体が必要なデータをセット
-    sharedPrms = (clfitersSharedPrms *)m_sharedPrms->ptr();
-    sharedPrms->is_saving = is_saving;
-    sharedPrms->nextOutFrameId = m_filter->getNextOutFrameId();
-    sharedPrms->pd.s.platform = (decltype(sharedPrms->pd.s.platform))m_filter->platformID();
-    sharedPrms->pd.s.device = (decltype(sharedPrms->pd.s.device))m_filter->deviceID();
-    return TRUE;
-}
-
-int clcuFiltersExe::run() {
-    bool abort = false;
-    while (!abort && m_aviutlHandle && WaitForSingleObject(m_aviutlHandle.get(), 0) == WAIT_TIMEOUT) {
-        if (WaitForSingleObject(m_eventMesStart, 5000) == WAIT_TIMEOUT) {
-            continue;
-        }
-        int ret = 0;
-        const auto mes_type = ((clfitersSharedMesData*)m_sharedMessage->ptr())->type;
-        switch (mes_type) {
-        case clfitersMes::FuncProc:
-            ret = funcProc();
-            break;
-        case clfitersMes::Abort:
-            abort = true;
-            break;
-        case clfitersMes::None:
-            break;
-        default:
-            break;
-        }
-        ((clfitersSharedMesData*)m_sharedMessage->ptr())->ret = ret;
-        SetEvent(m_eventMesEnd);
-    }
-    return 0;
-}
+﻿// -----------------------------------------------------------------------------------------
+// clfilters by rigaya
+// -----------------------------------------------------------------------------------------
+//
+// The MIT License
+//
+// Copyright (c) 2024 rigaya
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// ------------------------------------------------------------------------------------------
+
+#include "clcufilters_exe.h"
+
+clcuFiltersExe::clcuFiltersExe() :
+    m_filter(),
+    m_aviutlHandle(),
+    m_eventMesStart(nullptr),
+    m_eventMesEnd(nullptr),
+    m_sharedMessage(),
+    m_sharedPrms(),
+    m_sharedFrames(),
+    m_ppid(0),
+    m_maxWidth(0),
+    m_maxHeight(0),
+    m_pitchBytes(0),
+    m_nextProcFrameId(-1),
+    m_frameCacheHost(),
+    m_cspThreads(0),
+    m_cspThreadParam(),
+    m_pipelineThread(true),
+    m_thPipeline(),
+    m_heSpecStart(),
+    m_heSpecFin(),
+    m_specAbort(false),
+    m_specRunning(false),
+    m_spec(),
+    m_log() { }
+clcuFiltersExe::~clcuFiltersExe() {
+    stopPipelineThread(); // m_filterより先に終了させる
+    for (auto& f : m_sharedFrames) {
+        f.reset();
+    }
+}
+
+int clcuFiltersExe::init(AviutlAufExeParams& prms) {
+    m_eventMesStart = prms.eventMesStart;
+    m_eventMesEnd = prms.eventMesEnd;
+    if (!m_eventMesStart || !m_eventMesEnd) {
+        AddMessage(RGY_LOG_ERROR, _T("Invalid event handles."));
+        return 1;
+    }
+    WaitForSingleObject(m_eventMesStart, INFINITE);
+    m_log = std::make_shared<RGYLog>(prms.logfile.c_str(), prms.log_level, false, true);
+
+    m_ppid = prms.ppid;
+    m_aviutlHandle = std::unique_ptr<std::remove_pointer<HANDLE>::type, handle_deleter>(OpenProcess(SYNCHRONIZE | PROCESS_VM_READ, FALSE, prms.ppid), handle_deleter());
+    if (!m_aviutlHandle) {
+        AddMessage(RGY_LOG_ERROR, _T("Failed to open Aviutl process handle %d.\n"), prms.ppid);
+        return 1;
+    }
+    AddMessage(RGY_LOG_DEBUG, _T("Opened Aviutl process handle %d.\n"), prms.ppid);
+
+    m_sharedMessage = std::make_unique<RGYSharedMemWin>(strsprintf(CLFILTER_SHARED_MEM_MESSAGE, prms.ppid).c_str(), sizeof(clfitersSharedMesData));
+    if (!m_sharedMessage || !m_sharedMessage->is_open()) {
+        AddMessage(RGY_LOG_ERROR, _T("Failed to open shared mem for messages.\n"));
+        m_sharedMessage.reset();
+        return 1;
+    }
+    AddMessage(RGY_LOG_DEBUG, _T("Opened shared mem for messages.\n"));
+
+    m_sharedPrms = std::make_unique<RGYSharedMemWin>(strsprintf(CLFILTER_SHARED_MEM_PRMS, prms.ppid).c_str(), sizeof(clfitersSharedPrms));
+    if (!m_sharedPrms || !m_sharedPrms->is_open()) {
+        AddMessage(RGY_LOG_ERROR, _T("Failed to open shared mem for parameters.\n"));
+        m_sharedPrms.reset();
+        return 1;
+    }
+    AddMessage(RGY_LOG_DEBUG, _T("Opened shared mem for parameters.\n"));
+
+    m_maxWidth = prms.max_w;
+    m_maxHeight = prms.max_h;
+    m_pitchBytes = get_shared_frame_pitch(m_maxWidth);
+    const int frameSize = get_shared_frame_size(m_maxWidth, m_maxHeight);
+    AddMessage(RGY_LOG_DEBUG, _T("Frame max %dx%d, pitch %d, size %d.\n"), m_maxWidth, m_maxHeight, m_pitchBytes, frameSize);
+
+    for (size_t i = 0; i < m_sharedFrames.size(); i++) {
+        m_sharedFrames[i] = std::make_unique<RGYSharedMemWin>(strsprintf(CLFILTER_SHARED_MEM_FRAMES, m_ppid, i).c_str(), frameSize);
+        if (!m_sharedFrames[i] || !m_sharedFrames[i]->is_open()) {
+            AddMessage(RGY_LOG_ERROR, _T("Failed to open shared mem for frame(%d).\n"), i);
+            return 1;
+        }
+        AddMessage(RGY_LOG_DEBUG, _T("Opened shared mem for frame(%d).\n"), i);
+    }
+
+    if (prms.cacheHostMB > 0) {
+        m_frameCacheHost = std::make_unique<clcuFilterFrameCache<clcuFilterFrameCacheHost>>((size_t)prms.cacheHostMB << 20);
+    }
+    AddMessage(RGY_LOG_DEBUG, _T("Frame cache: host %d MB.\n"), prms.cacheHostMB);
+    m_cspThreads = prms.cspThreads;
+    m_cspThreadParam = prms.cspThreadParam;
+    m_pipelineThread = prms.pipelineThread;
+    AddMessage(RGY_LOG_DEBUG, _T("Pipeline thread: %s.\n"), m_pipelineThread ? _T("on") : _T("off"));
+
+    //デバッグ用
+
+    initDevices();
+    // プロセス初期化処理の終了を通知
+    SetEvent(m_eventMesEnd);
+    return 0;
+}
+
+RGYFrameInfo clcuFiltersExe::setFrameInfo(const int iframeID, const int width, const int height, void *frame) {
+    RGYFrameInfo in;
+    //入力フレーム情報
+    in.width = width;
+    in.height = height;
+    in.pitch[0] = m_pitchBytes;
+    in.csp = RGY_CSP_YC48;
+    in.picstruct = RGY_PICSTRUCT_FRAME;
+    in.ptr[0] = (uint8_t *)frame;
+    in.mem_type = RGY_MEM_TYPE_CPU;
+    in.inputFrameId = iframeID;
+    return in;
+}
+
+RGYFrameInfo clcuFiltersExe::setFrameInfo(const int iframeID, const clfitersSharedFrameInfo& srcFrame, void *frame) {
+    if (srcFrame.csp != RGY_CSP_YUV444_16) {
+        return setFrameInfo(iframeID, srcFrame.width, srcFrame.height, frame);
+    }
+    //AviUtl側でYUV444(16bit)のplanar形式に変換済みの入力フレーム
+    RGYFrameInfo in;
+    in.width = srcFrame.width;
+    in.height = srcFrame.height;
+    in.csp = RGY_CSP_YUV444_16;
+    in.picstruct = RGY_PICSTRUCT_FRAME;
+    for (int i = 0; i < RGY_CSP_PLANES[RGY_CSP_YUV444_16]; i++) {
+        in.ptr[i] = (uint8_t *)frame + (size_t)srcFrame.pitchBytes * srcFrame.height * i;
+        in.pitch[i] = srcFrame.pitchBytes;
+    }
+    in.mem_type = RGY_MEM_TYPE_CPU;
+    in.inputFrameId = iframeID;
+    return in;
+}
+
+bool clcuFiltersExe::getOutFrameCached(const clcuFilterFrameCacheKey& key, RGYFrameInfo *pOutputFrame) {
+    if (m_frameCacheHost) {
+        auto frameCache = m_frameCacheHost->get(key);
+        if (frameCache && frameCache->width == pOutputFrame->width && frameCache->height == pOutputFrame->height) {
+            //GPUを使わずに、そのまま共有メモリにコピーする
+            const size_t widthBytes = (size_t)frameCache->width * SIZE_PIXEL_YC;
+            for (int y = 0; y < frameCache->height; y++) {
+                memcpy(pOutputFrame->ptr[0] + (size_t)pOutputFrame->pitch[0] * y, frameCache->data.data() + widthBytes * y, widthBytes);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void clcuFiltersExe::setOutFrameCache(const clcuFilterFrameCacheKey& key, const RGYFrameInfo *pOutputFrame) {
+    if (m_frameCacheHost) {
+        clcuFilterFrameCacheHost frameCache;
+        frameCache.width = pOutputFrame->width;
+        frameCache.height = pOutputFrame->height;
+        const size_t widthBytes = (size_t)frameCache.width * SIZE_PIXEL_YC;
+        frameCache.data.resize(widthBytes * frameCache.height);
+        for (int y = 0; y < frameCache.height; y++) {
+            memcpy(frameCache.data.data() + widthBytes * y, pOutputFrame->ptr[0] + (size_t)pOutputFrame->pitch[0] * y, widthBytes);
+        }
+        const auto frameSize = frameCache.data.size();
+        m_frameCacheHost->put(key, std::move(frameCache), frameSize);
+    }
+}
+
+void clcuFiltersExe::setProcResult(const int is_saving) {
+    // 本体が必要なデータをセット
+    auto sharedPrms = (clfitersSharedPrms *)m_sharedPrms->ptr();
+    sharedPrms->is_saving = is_saving;
+    sharedPrms->nextOutFrameId = m_filter->getNextOutFrameId();
+    sharedPrms->pd.s.platform = (decltype(sharedPrms->pd.s.platform))m_filter->platformID();
+    sharedPrms->pd.s.device = (decltype(sharedPrms->pd.s.device))m_filter->deviceID();
+}
+
+void clcuFiltersExe::startPipelineThread() {
+    if (m_thPipeline.joinable()) {
+        return;
+    }
+    m_heSpecStart = std::unique_ptr<void, handle_deleter>(CreateEvent(nullptr, false, false, nullptr), handle_deleter());
+    m_heSpecFin = std::unique_ptr<void, handle_deleter>(CreateEvent(nullptr, false, false, nullptr), handle_deleter());
+    m_specAbort = false;
+    m_specRunning = false;
+    m_thPipeline = std::thread([this]() {
+        WaitForSingleObject(m_heSpecStart.get(), INFINITE);
+        while (!m_specAbort) {
+            runSpecJob();
+            SetEvent(m_heSpecFin.get());
+            WaitForSingleObject(m_heSpecStart.get(), INFINITE);
+        }
+    });
+    AddMessage(RGY_LOG_DEBUG, _T("Started pipeline thread.\n"));
+}
+
+void clcuFiltersExe::stopPipelineThread() {
+    if (m_thPipeline.joinable()) {
+        waitPipelineThread();
+        m_specAbort = true;
+        SetEvent(m_heSpecStart.get());
+        m_thPipeline.join();
+    }
+    m_heSpecStart.reset();
+    m_heSpecFin.reset();
+    m_spec.frameId = -1;
+}
+
+RGY_ERR clcuFiltersExe::waitPipelineThread() {
+    if (!m_specRunning) {
+        return RGY_ERR_NONE;
+    }
+    WaitForSingleObject(m_heSpecFin.get(), INFINITE);
+    m_specRunning = false;
+    if (m_spec.err != RGY_ERR_NONE) {
+        AddMessage(RGY_LOG_ERROR, _T("Failed to process frame %d in advance: %s.\n"), m_spec.frameId, get_err_mes(m_spec.err));
+        m_spec.frameId = -1;
+    }
+    return m_spec.err;
+}
+
+void clcuFiltersExe::runSpecJob() {
+    // パイプラインスレッドで実行される
+    // 完了するまで(waitPipelineThread)、メインスレッドはm_filterに触れない
+    auto err = m_filter->setThreadContext();
+    if (err == RGY_ERR_NONE) {
+        //前回のfuncProcで処理を投入済みの次のフレームを取得しておく (GPUからの転送 + YC48への変換)
+        RGYFrameInfo out = setFrameInfo(m_spec.frameId, m_spec.prm.outWidth, m_spec.prm.outHeight, m_spec.data.data());
+        err = m_filter->getOutFrame(&out);
+    }
+    if (err == RGY_ERR_NONE && m_spec.procFrameId >= 0) {
+        //転送済みのその次のフレームの処理も投入しておく
+        //getOutFrameのあとにしないと、転送が処理の完了を待つことになってしまう
+        err = m_filter->proc(m_spec.procFrameId, m_spec.prm);
+    }
+    m_spec.err = err;
+}
+
+int clcuFiltersExe::funcProc() {
+    // エラーメッセージ用の領域を初期化
+    getMessagePtr()->data[0] = '\0';
+
+    // 先行処理が実行中なら、その完了を待ってからm_filterを使用する
+    if (waitPipelineThread() != RGY_ERR_NONE) {
+        m_filter->resetPipeline();
+        m_nextProcFrameId = -1;
+        return FALSE;
+    }
+
+    clFilterChainParam prm;
+    auto sharedPrms = (clfitersSharedPrms *)m_sharedPrms->ptr();
+    const auto dev_pd = sharedPrms->pd;
+    const auto current_frame = sharedPrms->currentFrameId;
+    const auto frame_n = sharedPrms->frame_n;
+    const auto resetPipeline = sharedPrms->resetPipeLine;
+    auto is_saving = sharedPrms->is_saving;
+    // どのフレームから処理を開始すべきか?
+    auto frameIn = sharedPrms->frameIn;
+    const auto frameInFin = sharedPrms->frameInFin;
+    auto frameProc = sharedPrms->frameProc;
+    //auto frameOut = sharedPrms->frameOut;
+    prm.setPrmFromCmd(char_to_tstring(sharedPrms->prms));
+    if (!m_filter
+        || m_filter->platformID() != dev_pd.s.platform
+        || m_filter->deviceID() != dev_pd.s.device) {
+        int ret = 0;
+        std::string mes = AUF_FULL_NAME;
+        mes += ": ";
+        auto sts = initDevice(sharedPrms, prm);
+        if (sts != RGY_ERR_NONE) {
+            mes += LB_WND_OPENCL_UNAVAIL;
+            getMessagePtr()->ret = ret;
+            strcpy_s(getMessagePtr()->data, mes.c_str());
+            return sts;
+        }
+    }
+
+    // 保存モード(is_saving=true)の時に、どのくらい先まで処理をしておくべきか?
+    static_assert(frameInOffset < clcuFilterFrameBuffer::bufSize);
+    static_assert(frameInOffset < _countof(clfitersSharedPrms::srcFrame));
+    // 先行して出力フレームを取得済みなら、m_filter側は既にその次のフレームを指している
+    const int nextOutFrameId = (m_spec.frameId >= 0) ? m_spec.frameId : m_filter->getNextOutFrameId();
+    if (resetPipeline
+        || nextOutFrameId != current_frame) { // 出てくる予定のフレームがずれていたらリセット
+        m_filter->resetPipeline();
+        m_nextProcFrameId = -1;
+        m_spec.frameId = -1;
+    }
+    // -- キャッシュの確認 ---------------------------------------------------------------
+    // プレビュー時に同じ範囲を行き来する場合、処理済みのフレームはキャッシュから返す
+    // (キャッシュが無効なら、キーとなる入力フレーム全体のハッシュも計算しない)
+    const bool useFrameCache = m_frameCacheHost && !is_saving && frame_n > 0 && current_frame >= 0
+        && frameIn == current_frame && frameInFin == current_frame;
+    clcuFilterFrameCacheKey cacheKey;
+    if (useFrameCache) {
+        const auto& srcFrame = sharedPrms->srcFrame[0];
+        const RGYFrameInfo in = setFrameInfo(current_frame, srcFrame, m_sharedFrames[current_frame % m_sharedFrames.size()]->ptr());
+        // プレビューの処理領域が異なれば、別のフレームとして扱う
+        const auto roiHash = clcuFilterHashData(&sharedPrms->roi, sizeof(sharedPrms->roi), dev_pd.i);
+        const auto prmHash = clcuFilterHashData(sharedPrms->prms, strnlen(sharedPrms->prms, sizeof(sharedPrms->prms)), roiHash);
+        cacheKey = clcuFilterFrameCacheKey(current_frame, clcuFilterHashFrameHost(&in), prmHash);
+        RGYFrameInfo out = setFrameInfo(current_frame, prm.outWidth, prm.outHeight, m_sharedFrames[(current_frame + 1) % m_sharedFrames.size()]->ptr());
+        if (getOutFrameCached(cacheKey, &out)) {
+            m_log->write(RGY_LOG_TRACE, RGY_LOGT_CORE, "exe:   set frame out from cache: m_sharedFrames[%d] -> %d\n", (current_frame + 1) % m_sharedFrames.size(), current_frame);
+            setProcResult(is_saving);
+            return TRUE;
+        }
+    }
+    m_log->write(RGY_LOG_TRACE, RGY_LOGT_CORE, "exe:   start get frame In: %d -> %d, roi %d,%d %dx%d (src %d,%d %dx%d)\n", frameIn, frameInFin,
+        sharedPrms->roi.x, sharedPrms->roi.y, sharedPrms->roi.width, sharedPrms->roi.height,
+        sharedPrms->roiSrc.x, sharedPrms->roiSrc.y, sharedPrms->roiSrc.width, sharedPrms->roiSrc.height);
+
+    // -- フレームの転送 -----------------------------------------------------------------
+    // frameIn の終了フレーム
+    //const int frameInFin = (is_saving) ? std::min(current_frame + frameInOffset, frame_n - 1) : current_frame;
+    // フレーム転送の実行
+    auto sts = RGY_ERR_NONE;
+    for (int i = 0; frameIn <= frameInFin; frameIn++, i++) {
+        if (i > 0) {
+            // 2フレーム目以降は、プラグイン側の処理完了を待つ必要がある
+            while (WaitForSingleObject(m_eventMesStart, 100) == WAIT_TIMEOUT) {
+                // Aviutl側が終了していたら終了
+                if (m_aviutlHandle && WaitForSingleObject(m_aviutlHandle.get(), 0) != WAIT_TIMEOUT) {
+                    return FALSE;
+                }
+            }
+        }
+        const auto& srcFrame = sharedPrms->srcFrame[i];
+        const RGYFrameInfo in = setFrameInfo(frameIn, srcFrame, m_sharedFrames[current_frame % m_sharedFrames.size()]->ptr());
+        // 受け取り中のエラーは保持するが、まずは最後まで受け取ることを優先する
+        if (sts == RGY_ERR_NONE) {
+            // 成功していた場合のみGPUに転送する
+            sts = m_filter->sendInFrame(&in);
+            m_log->write(RGY_LOG_TRACE, RGY_LOGT_CORE, "exe:   get frame In: srcFrame[%d]=%d - m_sharedFrames[%d]\n", i, srcFrame.frameId, current_frame % m_sharedFrames.size());
+        }
+        if (frameIn < frameInFin) {
+            // まだ受け取るフレームがあるなら、GPUへの転送完了を通知
+            SetEvent(m_eventMesEnd);
+        } 
+    }
+    if (sts != RGY_ERR_NONE) {
+        return sts;
+    }
+    if (frame_n <= 0 || current_frame < 0) {
+        return TRUE; // 何もしない
+    }
+    // -- フレームの処理 -----------------------------------------------------------------
+    bool reprocessSent = false;
+    if (prm != m_filter->getPrm()) { // パラメータが変更されていたら、
+        frameProc = current_frame;   // 現在のフレームから処理をやり直す
+        if (is_saving) {
+            // 先行して取得したフレームや処理済みのフレームは使えないので、パイプラインをリセットする
+            // リセット後は入力側のリングバッファの位置も戻るため、転送済みのフレームはここですべて処理しておく
+            m_filter->resetPipeline();
+            m_nextProcFrameId = -1;
+            reprocessSent = true;
+        }
+        m_spec.frameId = -1;
+    } else if (is_saving && m_nextProcFrameId >= 0) {
+        frameProc = std::max(m_nextProcFrameId, current_frame); // 前回までに処理済みのフレームは飛ばす
+    }
+    // frameProc の終了フレーム (出力より1フレーム先まで処理しておく)
+    const int frameProcNeed = (is_saving) ? std::min(current_frame + frameProcOffset, frame_n - 1) : current_frame;
+    const int frameProcFin = (reprocessSent) ? std::max(frameProcNeed, frameInFin) : frameProcNeed;
+    // フレーム処理の実行
+    for (; frameProc <= frameProcFin; frameProc++) {
+        m_log->write(RGY_LOG_TRACE, RGY_LOGT_CORE, "exe:   filter proc: %d\n", frameProc);
+        if (m_filter->proc(frameProc, prm) != RGY_ERR_NONE) {
+            return FALSE;
+        }
+    }
+    m_nextProcFrameId = (is_saving) ? frameProcFin + 1 : -1;
+    // -- フレームの取得 -----------------------------------------------------------------
+    RGYFrameInfo out = setFrameInfo(current_frame, prm.outWidth, prm.outHeight, m_sharedFrames[(current_frame + 1) % m_sharedFrames.size()]->ptr());
+    if (m_spec.frameId == current_frame) {
+        //先行して取得済みのフレームを共有メモリにコピーするだけでよい
+        memcpy(out.ptr[0], m_spec.data.data(), (size_t)m_pitchBytes * out.height);
+        m_spec.frameId = -1;
+    } else if (m_filter->getOutFrame(&out) != RGY_ERR_NONE) {
+        return FALSE;
+    }
+    m_log->write(RGY_LOG_TRACE, RGY_LOGT_CORE, "exe:   set frame out: m_sharedFrames[%d] -> %d, NextOutFrameId %d\n", (current_frame + 1) % m_sharedFrames.size(), current_frame, m_filter->getNextOutFrameId());
+    if (useFrameCache) {
+        setOutFrameCache(cacheKey, &out);
+    }
+    setProcResult(is_saving);
+
+    // -- 先行処理の開始 -----------------------------------------------------------------
+    // AviUtl側が出力フレームを受け取って次のフレームを用意している間に、
+    // 処理済みの次のフレームの取得と、転送済みのその次のフレームの処理の投入をパイプラインスレッドで行っておく
+    if (m_pipelineThread && is_saving && current_frame + 1 < frame_n && m_nextProcFrameId > current_frame + 1) {
+        startPipelineThread();
+        m_spec.frameId = current_frame + 1;
+        m_spec.procFrameId = -1;
+        m_spec.prm = prm;
+        m_spec.err = RGY_ERR_NONE;
+        m_spec.data.resize((size_t)m_pitchBytes * prm.outHeight);
+        if (m_nextProcFrameId == current_frame + 2 && frameInFin >= current_frame + 2) {
+            m_spec.procFrameId = current_frame + 2;
+            m_nextProcFrameId = current_frame + 3;
+        }
+        m_log->write(RGY_LOG_TRACE, RGY_LOGT_CORE, "exe:   start pipeline thread: get frame %d, proc %d\n", m_spec.frameId, m_spec.procFrameId);
+        m_specRunning = true;
+        SetEvent(m_heSpecStart.get());
+    }
+    return TRUE;
+}
+
+int clcuFiltersExe::run() {
+    bool abort = false;
+    while (!abort && m_aviutlHandle && WaitForSingleObject(m_aviutlHandle.get(), 0) == WAIT_TIMEOUT) {
+        if (WaitForSingleObject(m_eventMesStart, 5000) == WAIT_TIMEOUT) {
+            continue;
+        }
+        int ret = 0;
+        const auto mes_type = ((clfitersSharedMesData*)m_sharedMessage->ptr())->type;
+        switch (mes_type) {
+        case clfitersMes::FuncProc:
+            ret = funcProc();
+            break;
+        case clfitersMes::Abort:
+            stopPipelineThread();
+            abort = true;
+            break;
+        case clfitersMes::None:
+            break;
+        default:
+            break;
+        }
+        ((clfitersSharedMesData*)m_sharedMessage->ptr())->ret = ret;
+        SetEvent(m_eventMesEnd);
+    }
+    return 0;
+}
@@ -1,111 +1,145 @@
-﻿// -----------------------------------------------------------------------------------------
-// clfilters by rigaya
-// -----------------------------------------------------------------------------------------
-//
-// The MIT License
-//
-// Copyright (c) 2024 rigaya
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-// ------------------------------------------------------------------------------------------
-
-#ifndef __CLCUFILTERS_EXE_H__
-#define __CLCUFILTERS_EXE_H__
-
-#include <memory>
-#include <iostream>
-#include "rgy_osdep.h"
-#include "rgy_tchar.h"
-#include "rgy_log.h"
-#include "rgy_event.h"
-#include "rgy_shared_mem.h"
-#include "clcufilters_shared.h"
-#include "clcufilters_chain_prm.h"
-#include "clcufilters_exe_cmd.h"
-#include "clcufilters_version.h"
-#include "clcufilters_chain.h"
-#include "rgy_util.h"
-#include "rgy_cmd.h"
-
-//---------------------------------------------------------------------
-//        ラベル
-//---------------------------------------------------------------------
-#if !CLFILTERS_EN
-static const char *LB_WND_OPENCL_UNAVAIL = "フィルタは無効です: OpenCLを使用できません。";
-static const char *LB_WND_OPENCL_AVAIL = "OpenCL 有効";
-static const char *LB_CX_OPENCL_DEVICE = "デバイス選択";
-#else
-static const char *LB_WND_OPENCL_UNAVAIL = "Filter disabled, OpenCL could not be used.";
-static const char *LB_WND_OPENCL_AVAIL = "OpenCL Enabled";
-static const char *LB_CX_OPENCL_DEVICE = "Device";
-#endif
-
-class clcuFiltersExe {
-public:
-    clcuFiltersExe();
-    virtual ~clcuFiltersExe();
-    int init(AviutlAufExeParams& prms);
-    int run();
-    void AddMessage(RGYLogLevel log_level, const tstring &str) {
-        if (m_log == nullptr || log_level < m_log->getLogLevel(RGY_LOGT_APP)) {
-            return;
-        }
-        if (log_level >= RGY_LOG_ERROR && m_sharedMessage && m_sharedMessage->is_open()) {
-            strcat_s(getMessagePtr()->data, tchar_to_string(str).c_str());
-        }
-
-        m_log->write_log(log_level, RGY_LOGT_APP, (tstring(_T("clfilters[exe]: ")) + str).c_str());
-    }
-    void AddMessage(RGYLogLevel log_level, const TCHAR *format, ...) {
-        if (m_log == nullptr || log_level < m_log->getLogLevel(RGY_LOGT_CORE)) {
-            return;
-        }
-        va_list args;
-        va_start(args, format);
-        int len = _vsctprintf(format, args) + 1; // _vscprintf doesn't count terminating '\0'
-        tstring buffer;
-        buffer.resize(len, _T('\0'));
-        _vstprintf_s(&buffer[0], len, format, args);
-        va_end(args);
-        AddMessage(log_level, buffer);
-    }
-    virtual RGY_ERR initDevices() = 0;
-    virtual std::string checkDevices() = 0;
-    virtual bool isCUDA() const = 0;
-protected:
-    virtual RGY_ERR initDevice(const clfitersSharedPrms *sharedPrms, clFilterChainParam& prm) = 0;
-    int funcProc();
-    clfitersSharedMesData *getMessagePtr() { return (clfitersSharedMesData*)m_sharedMessage->ptr(); }
-    RGYFrameInfo setFrameInfo(const int iframeID, const int width, const int height, void *frame);
-    std::unique_ptr<clcuFilterChain> m_filter;
-    std::unique_ptr<std::remove_pointer<HANDLE>::type, handle_deleter> m_aviutlHandle;
-    HANDLE m_eventMesStart;
-    HANDLE m_eventMesEnd;
-    std::unique_ptr<RGYSharedMemWin> m_sharedMessage;
-    std::unique_ptr<RGYSharedMemWin> m_sharedPrms;
-    std::array<std::unique_ptr<RGYSharedMemWin>,2> m_sharedFrames;
-    size_t m_ppid;
-    int m_maxWidth;
-    int m_maxHeight;
-    int m_pitchBytes;
-    std::shared_ptr<RGYLog> m_log;
-};
-
-#endif // !__CLCUFILTERS_EXE_H__
+﻿// -----------------------------------------------------------------------------------------
+// clfilters by rigaya
+// -----------------------------------------------------------------------------------------
+//
+// The MIT License
+//
+// Copyright (c) 2024 rigaya
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// ------------------------------------------------------------------------------------------
+
+#ifndef __CLCUFILTERS_EXE_H__
+#define __CLCUFILTERS_EXE_H__
+
+#include <memory>
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "rgy_osdep.h"
+#include "rgy_tchar.h"
+#include "rgy_log.h"
+#include "rgy_event.h"
+#include "rgy_shared_mem.h"
+#include "clcufilters_shared.h"
+#include "clcufilters_chain_prm.h"
+#include "clcufilters_exe_cmd.h"
+#include "clcufilters_version.h"
+#include "clcufilters_chain.h"
+#include "clcufilters_frame_cache.h"
+#include "rgy_util.h"
+#include "rgy_cmd.h"
+
+//---------------------------------------------------------------------
+//        ラベル
+//---------------------------------------------------------------------
+#if !CLFILTERS_EN
+static const char *LB_WND_OPENCL_UNAVAIL = "フィルタは無効です: OpenCLを使用できません。";
+static const char *LB_WND_OPENCL_AVAIL = "OpenCL 有効";
+static const char *LB_CX_OPENCL_DEVICE = "デバイス選択";
+#else
+static const char *LB_WND_OPENCL_UNAVAIL = "Filter disabled, OpenCL could not be used.";
+static const char *LB_WND_OPENCL_AVAIL = "OpenCL Enabled";
+static const char *LB_CX_OPENCL_DEVICE = "Device";
+#endif
+
+// 保存モードで、AviUtl側の処理中(funcProcの呼び出しの間)に先行して行う処理
+struct clcuFiltersSpecJob {
+    int frameId;             // 先行して取得する出力フレーム (-1: なし)
+    int procFrameId;         // 先行して処理を投入するフレーム (-1: なし)
+    clFilterChainParam prm;  // 処理に使用したパラメータ (次の呼び出しで変更されていたら、取得したフレームは破棄する)
+    RGY_ERR err;
+    std::vector<uint8_t> data; // 取得した出力フレーム (YC48, pitchは共有メモリと同じ)
+
+    clcuFiltersSpecJob() : frameId(-1), procFrameId(-1), prm(), err(RGY_ERR_NONE), data() {};
+};
+
+class clcuFiltersExe {
+public:
+    clcuFiltersExe();
+    virtual ~clcuFiltersExe();
+    int init(AviutlAufExeParams& prms);
+    int run();
+    void AddMessage(RGYLogLevel log_level, const tstring &str) {
+        if (m_log == nullptr || log_level < m_log->getLogLevel(RGY_LOGT_APP)) {
+            return;
+        }
+        if (log_level >= RGY_LOG_ERROR && m_sharedMessage && m_sharedMessage->is_open()) {
+            strcat_s(getMessagePtr()->data, tchar_to_string(str).c_str());
+        }
+
+        m_log->write_log(log_level, RGY_LOGT_APP, (tstring(_T("clfilters[exe]: ")) + str).c_str());
+    }
+    void AddMessage(RGYLogLevel log_level, const TCHAR *format, ...) {
+        if (m_log == nullptr || log_level < m_log->getLogLevel(RGY_LOGT_CORE)) {
+            return;
+        }
+        va_list args;
+        va_start(args, format);
+        int len = _vsctprintf(format, args) + 1; // _vscprintf doesn't count terminating '\0'
+        tstring buffer;
+        buffer.resize(len, _T('\0'));
+        _vstprintf_s(&buffer[0], len, format, args);
+        va_end(args);
+        AddMessage(log_level, buffer);
+    }
+    virtual RGY_ERR initDevices() = 0;
+    virtual std::string checkDevices() = 0;
+    virtual bool isCUDA() const = 0;
+protected:
+    virtual RGY_ERR initDevice(const clfitersSharedPrms *sharedPrms, clFilterChainParam& prm) = 0;
+    int funcProc();
+    clfitersSharedMesData *getMessagePtr() { return (clfitersSharedMesData*)m_sharedMessage->ptr(); }
+    RGYFrameInfo setFrameInfo(const int iframeID, const int width, const int height, void *frame);
+    RGYFrameInfo setFrameInfo(const int iframeID, const clfitersSharedFrameInfo& srcFrame, void *frame);
+    bool getOutFrameCached(const clcuFilterFrameCacheKey& key, RGYFrameInfo *pOutputFrame);
+    void setOutFrameCache(const clcuFilterFrameCacheKey& key, const RGYFrameInfo *pOutputFrame);
+    void setProcResult(const int is_saving);
+    void startPipelineThread();
+    void stopPipelineThread();
+    RGY_ERR waitPipelineThread();
+    void runSpecJob();
+    std::unique_ptr<clcuFilterChain> m_filter;
+    std::unique_ptr<std::remove_pointer<HANDLE>::type, handle_deleter> m_aviutlHandle;
+    HANDLE m_eventMesStart;
+    HANDLE m_eventMesEnd;
+    std::unique_ptr<RGYSharedMemWin> m_sharedMessage;
+    std::unique_ptr<RGYSharedMemWin> m_sharedPrms;
+    std::array<std::unique_ptr<RGYSharedMemWin>,2> m_sharedFrames;
+    size_t m_ppid;
+    int m_maxWidth;
+    int m_maxHeight;
+    int m_pitchBytes;
+    int m_nextProcFrameId; // 保存モードで次に処理すべきフレーム (先行して処理済みのフレームを飛ばすため)
+    std::unique_ptr<clcuFilterFrameCache<clcuFilterFrameCacheHost>> m_frameCacheHost; // プレビュー用の出力フレームのキャッシュ(CPUメモリ)
+    int m_cspThreads;      // 色空間変換のスレッド数 (0:自動)
+    RGYParamThread m_cspThreadParam; // 色空間変換のスレッドのaffinity/優先度
+    bool m_pipelineThread; // 保存モードで、次のフレームの取得/処理の投入をAviUtl側の処理中に先行して行う
+    std::thread m_thPipeline;
+    std::unique_ptr<void, handle_deleter> m_heSpecStart;
+    std::unique_ptr<void, handle_deleter> m_heSpecFin;
+    std::atomic<bool> m_specAbort;   // パイプラインスレッドの終了要求
+    std::atomic<bool> m_specRunning; // 先行処理を実行中 (m_heSpecFinを待つ必要がある)
+    clcuFiltersSpecJob m_spec;
+    std::shared_ptr<RGYLog> m_log;
+};
+
+#endif // !__CLCUFILTERS_EXE_H__
@@ -0,0 +1,83 @@
+﻿// -----------------------------------------------------------------------------------------
+// clfilters by rigaya
+// -----------------------------------------------------------------------------------------
+//
+// The MIT License
+//
+// Copyright (c) 2022 rigaya
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// ------------------------------------------------------------------------------------------
+
+#include <cstring>
+#include "clcufilters_frame_cache.h"
+#include "clcufilters_chain_prm.h"
+
+static inline uint64_t hash_rotl(const uint64_t x, const int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t hash_mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+// 暗号学的な強度は不要なので、4系列並列に8byteずつ処理する簡易なハッシュとする
+uint64_t clcuFilterHashData(const void *ptr, const size_t size, const uint64_t seed) {
+    static const uint64_t PRIME0 = 0x9e3779b97f4a7c15ull;
+    static const uint64_t PRIME1 = 0xc2b2ae3d27d4eb4full;
+    const uint8_t *p = (const uint8_t *)ptr;
+    uint64_t h[4] = { seed + PRIME0, seed + PRIME1, seed, seed - PRIME0 };
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        uint64_t v[4];
+        memcpy(v, p + i, sizeof(v));
+        for (int j = 0; j < 4; j++) {
+            h[j] = hash_rotl(h[j] + v[j] * PRIME1, 31) * PRIME0;
+        }
+    }
+    uint64_t ret = hash_rotl(h[0], 1) + hash_rotl(h[1], 7) + hash_rotl(h[2], 12) + hash_rotl(h[3], 18) + size;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t v;
+        memcpy(&v, p + i, sizeof(v));
+        ret = hash_rotl(ret ^ (v * PRIME1), 27) * PRIME0;
+    }
+    for (; i < size; i++) {
+        ret = hash_rotl(ret ^ (p[i] * PRIME0), 11) * PRIME1;
+    }
+    return hash_mix(ret);
+}
+
+uint64_t clcuFilterHashFrameHost(const RGYFrameInfo *frame) {
+    const bool isYC48 = frame->csp == RGY_CSP_YC48;
+    const int planes = (isYC48) ? 1 : RGY_CSP_PLANES[frame->csp];
+    const size_t widthBytes = (size_t)frame->width * ((isYC48) ? SIZE_PIXEL_YC : sizeof(uint16_t));
+    uint64_t hash = clcuFilterHashData(&frame->width, sizeof(frame->width), frame->height);
+    for (int iplane = 0; iplane < planes; iplane++) {
+        for (int y = 0; y < frame->height; y++) {
+            hash = clcuFilterHashData(frame->ptr[iplane] + (size_t)frame->pitch[iplane] * y, widthBytes, hash);
+        }
+    }
+    return hash;
+}
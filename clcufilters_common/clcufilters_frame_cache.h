@@ -0,0 +1,128 @@
+﻿// -----------------------------------------------------------------------------------------
+// clfilters by rigaya
+// -----------------------------------------------------------------------------------------
+//
+// The MIT License
+//
+// Copyright (c) 2022 rigaya
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// ------------------------------------------------------------------------------------------
+
+#ifndef __CLCUFILTERS_FRAME_CACHE_H__
+#define __CLCUFILTERS_FRAME_CACHE_H__
+
+#include <cstdint>
+#include <list>
+#include <vector>
+#include <unordered_map>
+#include "rgy_frame_info.h"
+
+// 出力フレームのキャッシュのキー
+struct clcuFilterFrameCacheKey {
+    int frameId;      // フレーム番号
+    uint64_t srcHash; // 入力フレームの内容のハッシュ
+    uint64_t prmHash; // パラメータのハッシュ
+
+    clcuFilterFrameCacheKey() : frameId(-1), srcHash(0), prmHash(0) {};
+    clcuFilterFrameCacheKey(int frameId_, uint64_t srcHash_, uint64_t prmHash_) : frameId(frameId_), srcHash(srcHash_), prmHash(prmHash_) {};
+    bool operator==(const clcuFilterFrameCacheKey& x) const {
+        return frameId == x.frameId && srcHash == x.srcHash && prmHash == x.prmHash;
+    }
+};
+
+struct clcuFilterFrameCacheKeyHash {
+    size_t operator()(const clcuFilterFrameCacheKey& key) const {
+        return (size_t)(key.srcHash ^ (key.prmHash * 31) ^ ((uint64_t)key.frameId << 32));
+    }
+};
+
+uint64_t clcuFilterHashData(const void *ptr, const size_t size, const uint64_t seed = 0);
+// CPU上のフレーム(YC48, またはplanarのYUV444(16bit))の内容のハッシュ
+uint64_t clcuFilterHashFrameHost(const RGYFrameInfo *frame);
+
+// サイズの上限を持つLRUキャッシュ
+template<typename T>
+class clcuFilterFrameCache {
+public:
+    clcuFilterFrameCache(const size_t budget) : m_list(), m_map(), m_budget(budget), m_used(0) {};
+    ~clcuFilterFrameCache() { clear(); };
+
+    // キャッシュにあれば、最近使用したものとしてポインタを返す
+    T *get(const clcuFilterFrameCacheKey& key) {
+        auto it = m_map.find(key);
+        if (it == m_map.end()) {
+            return nullptr;
+        }
+        m_list.splice(m_list.begin(), m_list, it->second);
+        return &it->second->value;
+    }
+    // キャッシュに追加し、上限を超えた分は古いものから破棄する
+    bool put(const clcuFilterFrameCacheKey& key, T&& value, const size_t size) {
+        if (size > m_budget) {
+            return false;
+        }
+        erase(key);
+        while (m_used + size > m_budget && m_list.size() > 0) {
+            erase(m_list.back().key);
+        }
+        m_list.push_front(Entry{ key, std::move(value), size });
+        m_map[key] = m_list.begin();
+        m_used += size;
+        return true;
+    }
+    void erase(const clcuFilterFrameCacheKey& key) {
+        auto it = m_map.find(key);
+        if (it != m_map.end()) {
+            m_used -= it->second->size;
+            m_list.erase(it->second);
+            m_map.erase(it);
+        }
+    }
+    void clear() {
+        m_map.clear();
+        m_list.clear();
+        m_used = 0;
+    }
+    size_t budget() const { return m_budget; }
+    size_t used() const { return m_used; }
+    size_t count() const { return m_list.size(); }
+protected:
+    struct Entry {
+        clcuFilterFrameCacheKey key;
+        T value;
+        size_t size;
+    };
+    std::list<Entry> m_list; // 先頭が最近使用したもの
+    std::unordered_map<clcuFilterFrameCacheKey, typename std::list<Entry>::iterator, clcuFilterFrameCacheKeyHash> m_map;
+    size_t m_budget;
+    size_t m_used;
+};
+
+// CPU上に保持する出力フレーム (YC48)
+struct clcuFilterFrameCacheHost {
+    int width;
+    int height;
+    std::vector<uint8_t> data;
+
+    clcuFilterFrameCacheHost() : width(0), height(0), data() {};
+};
+
+#endif //__CLCUFILTERS_FRAME_CACHE_H__
@@ -1,54 +1,73 @@
-﻿
-// Type
-// bit_depth
-// knn_radius
-
-#ifndef clamp
-#define clamp(x, low, high) (((x) <= (high)) ? (((x) >= (low)) ? (x) : (low)) : (high))
-#endif
-
-float lerpf(float v0, float v1, float t) {
-    float tmp = (1.0f-t)*v0;
-    return tmp + t*v1;
-}
-
-__kernel void kernel_denoise_knn(
-    __global uchar *restrict pDst,
-    const int dstPitch, const int dstWidth, const int dstHeight,
-    __read_only image2d_t src,
-    const float strength, const float lerpC, const float weight_threshold, const float lerp_threshold) {
-    const float knn_window_area = (float)((2 * knn_radius + 1) * (2 * knn_radius + 1));
-    const float inv_knn_window_area = 1.0f / knn_window_area;
-    const int ix = get_global_id(0);
-    const int iy = get_global_id(1);
-    const sampler_t sampler = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_NONE | CLK_FILTER_NEAREST;
-    if (ix < dstWidth && iy < dstHeight) {
-        float fCount = 0.0f;
-        float sumWeights = 0.0f;
-        float sum = 0.0f;
-        float center = (float)read_imagef(src, sampler, (int2)(ix, iy)).x;
-
-        #pragma unroll
-        for (int i = -knn_radius; i <= knn_radius; i++) {
-            const int loadix = clamp(ix, 0, dstWidth-1);
-            #pragma unroll
-            for (int j = -knn_radius; j <= knn_radius; j++) {
-                const int loadiy = clamp(iy, 0, dstHeight-1);
-                float clrIJ = (float)read_imagef(src, sampler, (int2)(loadix, loadiy)).x;
-                float distanceIJ = (center - clrIJ) * (center - clrIJ);
-
-                float weightIJ = native_exp(-(distanceIJ * strength + (i * i + j * j) * inv_knn_window_area));
-
-                sum += clrIJ * weightIJ;
-
-                sumWeights += weightIJ;
-
-                fCount += (weightIJ > weight_threshold) ? inv_knn_window_area : 0;
-            }
-        }
-        float lerpQ = (fCount > lerp_threshold) ? lerpC : 1.0f - lerpC;
-
-        __global Type *ptr = (__global Type *)(pDst + iy * dstPitch + ix * sizeof(Type));
-        ptr[0] = (Type)clamp(lerpf(sum * native_recip(sumWeights), center, lerpQ) * (float)((1<<bit_depth)-1), 0.0f, (1<<bit_depth) - 0.1f);
-    }
-}
+﻿
+// Type
+// bit_depth
+// knn_radius
+// SRC_IMAGE
+// strength_const, lerpC_const, weight_threshold_const, lerp_threshold_const (汎用版では各<name>_arg)
+
+#ifndef clamp
+#define clamp(x, low, high) (((x) <= (high)) ? (((x) >= (low)) ? (x) : (low)) : (high))
+#endif
+
+#if SRC_IMAGE
+#define SRC_PARAM __read_only image2d_t src
+#define LOAD_SRC(x, y) (float)read_imagef(src, sampler, (int2)(x, y)).x
+#else
+//imageを使わない場合は、バッファから直接読み込み、imageと同様に[0,1]に正規化する
+#define SRC_PARAM const __global uchar *restrict pSrc
+#define LOAD_SRC(x, y) load_src(pSrc, srcPitch, (x), (y))
+float load_src(const __global uchar *restrict pSrc, const int srcPitch, const int x, const int y) {
+    const __global Type *ptr = (const __global Type *)(pSrc + y * srcPitch + x * sizeof(Type));
+    return (float)ptr[0] * (1.0f / (float)((1 << (sizeof(Type) * 8)) - 1));
+}
+#endif
+
+float lerpf(float v0, float v1, float t) {
+    float tmp = (1.0f-t)*v0;
+    return tmp + t*v1;
+}
+
+__kernel void kernel_denoise_knn(
+    __global uchar *restrict pDst,
+    const int dstPitch, const int dstWidth, const int dstHeight,
+    SRC_PARAM, const int srcPitch,
+    const float strength_arg, const float lerpC_arg, const float weight_threshold_arg, const float lerp_threshold_arg) {
+    const float strength = strength_const;
+    const float lerpC = lerpC_const;
+    const float weight_threshold = weight_threshold_const;
+    const float lerp_threshold = lerp_threshold_const;
+    const float knn_window_area = (float)((2 * knn_radius + 1) * (2 * knn_radius + 1));
+    const float inv_knn_window_area = 1.0f / knn_window_area;
+    const int ix = get_global_id(0);
+    const int iy = get_global_id(1);
+    const sampler_t sampler = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_NONE | CLK_FILTER_NEAREST;
+    if (ix < dstWidth && iy < dstHeight) {
+        float fCount = 0.0f;
+        float sumWeights = 0.0f;
+        float sum = 0.0f;
+        float center = LOAD_SRC(ix, iy);
+
+        #pragma unroll
+        for (int i = -knn_radius; i <= knn_radius; i++) {
+            const int loadix = clamp(ix, 0, dstWidth-1);
+            #pragma unroll
+            for (int j = -knn_radius; j <= knn_radius; j++) {
+                const int loadiy = clamp(iy, 0, dstHeight-1);
+                float clrIJ = LOAD_SRC(loadix, loadiy);
+                float distanceIJ = (center - clrIJ) * (center - clrIJ);
+
+                float weightIJ = native_exp(-(distanceIJ * strength + (i * i + j * j) * inv_knn_window_area));
+
+                sum += clrIJ * weightIJ;
+
+                sumWeights += weightIJ;
+
+                fCount += (weightIJ > weight_threshold) ? inv_knn_window_area : 0;
+            }
+        }
+        float lerpQ = (fCount > lerp_threshold) ? lerpC : 1.0f - lerpC;
+
+        __global Type *ptr = (__global Type *)(pDst + iy * dstPitch + ix * sizeof(Type));
+        ptr[0] = (Type)clamp(lerpf(sum * native_recip(sumWeights), center, lerpQ) * (float)((1<<bit_depth)-1), 0.0f, (1<<bit_depth) - 0.1f);
+    }
+}
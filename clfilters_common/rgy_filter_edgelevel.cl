@@ -1,57 +1,78 @@
-﻿// Type
-// bit_depth
-
-#ifndef clamp
-#define clamp(x, low, high) (((x) <= (high)) ? (((x) >= (low)) ? (x) : (low)) : (high))
-#endif
-
-void check_min_max(float *vmin, float *vmax, float value) {
-    *vmax = max(*vmax, value);
-    *vmin = min(*vmin, value);
-}
-
-__kernel void kernel_edgelevel(
-    __global uchar *restrict pDst,
-    const int dstPitch, const int dstWidth, const int dstHeight,
-    __read_only image2d_t src,
-    const float strength, const float threshold, const float black, const float white) {
-    const int ix = get_global_id(0);
-    const int iy = get_global_id(1);
-    const sampler_t sampler = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_CLAMP_TO_EDGE | CLK_FILTER_NEAREST;
-
-    if (ix < dstWidth && iy < dstHeight) {
-        float center = (float)read_imagef(src, sampler, (int2)(ix, iy)).x;
-        float hmin = center;
-        float vmin = center;
-        float hmax = center;
-        float vmax = center;
-
-        check_min_max(&hmin, &hmax, (float)read_imagef(src, sampler, (int2)(ix - 2, iy)).x);
-        check_min_max(&vmin, &vmax, (float)read_imagef(src, sampler, (int2)(ix, iy - 2)).x);
-        check_min_max(&hmin, &hmax, (float)read_imagef(src, sampler, (int2)(ix - 1, iy)).x);
-        check_min_max(&vmin, &vmax, (float)read_imagef(src, sampler, (int2)(ix, iy - 1)).x);
-        check_min_max(&hmin, &hmax, (float)read_imagef(src, sampler, (int2)(ix + 1, iy)).x);
-        check_min_max(&vmin, &vmax, (float)read_imagef(src, sampler, (int2)(ix, iy + 1)).x);
-        check_min_max(&hmin, &hmax, (float)read_imagef(src, sampler, (int2)(ix + 2, iy)).x);
-        check_min_max(&vmin, &vmax, (float)read_imagef(src, sampler, (int2)(ix, iy + 2)).x);
-
-        if (hmax - hmin < vmax - vmin) {
-            hmax = vmax, hmin = vmin;
-        }
-
-        if (hmax - hmin > threshold) {
-            float avg = (hmin + hmax) * 0.5f;
-            if (center == hmin)
-                hmin -= black;
-            hmin -= black;
-            if (center == hmax)
-                hmax += white;
-            hmax += white;
-
-            center = min(max((center + ((center - avg) * strength)), hmin), hmax);
-        }
-
-        __global Type *ptr = (__global Type *)(pDst + iy * dstPitch + ix * sizeof(Type));
-        ptr[0] = (Type)(clamp(center, 0.0f, 1.0f - 1e-6f) * ((1 << (bit_depth))-1));
-    }
-}
+﻿// Type
+// bit_depth
+// SRC_IMAGE
+// strength_const, threshold_const, black_const, white_const (汎用版では各<name>_arg)
+
+#ifndef clamp
+#define clamp(x, low, high) (((x) <= (high)) ? (((x) >= (low)) ? (x) : (low)) : (high))
+#endif
+
+#if SRC_IMAGE
+#define SRC_PARAM __read_only image2d_t src
+#define LOAD_SRC(x, y) (float)read_imagef(src, sampler, (int2)(x, y)).x
+#else
+//imageを使わない場合は、バッファから直接読み込み、imageと同様に端の画素で補って[0,1]に正規化する
+#define SRC_PARAM const __global uchar *restrict pSrc
+#define LOAD_SRC(x, y) load_src(pSrc, srcPitch, dstWidth, dstHeight, (x), (y))
+float load_src(const __global uchar *restrict pSrc, const int srcPitch, const int width, const int height, int x, int y) {
+    x = clamp(x, 0, width - 1);
+    y = clamp(y, 0, height - 1);
+    const __global Type *ptr = (const __global Type *)(pSrc + y * srcPitch + x * sizeof(Type));
+    return (float)ptr[0] * (1.0f / (float)((1 << (sizeof(Type) * 8)) - 1));
+}
+#endif
+
+void check_min_max(float *vmin, float *vmax, float value) {
+    *vmax = max(*vmax, value);
+    *vmin = min(*vmin, value);
+}
+
+__kernel void kernel_edgelevel(
+    __global uchar *restrict pDst,
+    const int dstPitch, const int dstWidth, const int dstHeight,
+    SRC_PARAM, const int srcPitch,
+    const float strength_arg, const float threshold_arg, const float black_arg, const float white_arg) {
+    const float strength = strength_const;
+    const float threshold = threshold_const;
+    const float black = black_const;
+    const float white = white_const;
+    const int ix = get_global_id(0);
+    const int iy = get_global_id(1);
+    const sampler_t sampler = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_CLAMP_TO_EDGE | CLK_FILTER_NEAREST;
+
+    if (ix < dstWidth && iy < dstHeight) {
+        float center = LOAD_SRC(ix, iy);
+        float hmin = center;
+        float vmin = center;
+        float hmax = center;
+        float vmax = center;
+
+        check_min_max(&hmin, &hmax, LOAD_SRC(ix - 2, iy));
+        check_min_max(&vmin, &vmax, LOAD_SRC(ix, iy - 2));
+        check_min_max(&hmin, &hmax, LOAD_SRC(ix - 1, iy));
+        check_min_max(&vmin, &vmax, LOAD_SRC(ix, iy - 1));
+        check_min_max(&hmin, &hmax, LOAD_SRC(ix + 1, iy));
+        check_min_max(&vmin, &vmax, LOAD_SRC(ix, iy + 1));
+        check_min_max(&hmin, &hmax, LOAD_SRC(ix + 2, iy));
+        check_min_max(&vmin, &vmax, LOAD_SRC(ix, iy + 2));
+
+        if (hmax - hmin < vmax - vmin) {
+            hmax = vmax, hmin = vmin;
+        }
+
+        if (hmax - hmin > threshold) {
+            float avg = (hmin + hmax) * 0.5f;
+            if (center == hmin)
+                hmin -= black;
+            hmin -= black;
+            if (center == hmax)
+                hmax += white;
+            hmax += white;
+
+            center = min(max((center + ((center - avg) * strength)), hmin), hmax);
+        }
+
+        __global Type *ptr = (__global Type *)(pDst + iy * dstPitch + ix * sizeof(Type));
+        ptr[0] = (Type)(clamp(center, 0.0f, 1.0f - 1e-6f) * ((1 << (bit_depth))-1));
+    }
+}
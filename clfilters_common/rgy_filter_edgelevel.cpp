@@ -1,189 +1,235 @@
-﻿// -----------------------------------------------------------------------------------------
-// NVEnc by rigaya
-// -----------------------------------------------------------------------------------------
-//
-// The MIT License
-//
-// Copyright (c) 2014-2016 rigaya
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-// ------------------------------------------------------------------------------------------
-
-#define _USE_MATH_DEFINES
-#include <cmath>
-#include <map>
-#include <array>
-#include "rgy_filter_edgelevel.h"
-
-RGY_ERR RGYFilterEdgelevel::procPlane(RGYFrameInfo *pOutputPlane, const RGYFrameInfo *pInputPlane, RGYOpenCLQueue &queue, const std::vector<RGYOpenCLEvent> &wait_events, RGYOpenCLEvent *event) {
-    auto prm = std::dynamic_pointer_cast<RGYFilterParamEdgelevel>(m_param);
-    if (!prm) {
-        AddMessage(RGY_LOG_ERROR, _T("Invalid parameter type.\n"));
-        return RGY_ERR_INVALID_PARAM;
-    }
-    {
-        const float strength = prm->edgelevel.strength / (1 << 4);
-        const float threshold = prm->edgelevel.threshold / (1 << (RGY_CSP_BIT_DEPTH[pInputPlane->csp] - 1));
-        const float black = prm->edgelevel.black / (1 << RGY_CSP_BIT_DEPTH[pInputPlane->csp]);
-        const float white = prm->edgelevel.white / (1 << RGY_CSP_BIT_DEPTH[pInputPlane->csp]);
-        const char *kernel_name = "kernel_edgelevel";
-        RGYWorkSize local(32, 8);
-        RGYWorkSize global(pOutputPlane->width, pOutputPlane->height);
-        auto err = m_edgelevel.get()->kernel(kernel_name).config(queue, local, global, wait_events, event).launch(
-            (cl_mem)pOutputPlane->ptr[0], pOutputPlane->pitch[0], pOutputPlane->width, pOutputPlane->height,
-            (cl_mem)pInputPlane->ptr[0],
-            strength, threshold, black, white);
-        if (err != RGY_ERR_NONE) {
-            AddMessage(RGY_LOG_ERROR, _T("error at %s (procPlane(%s)): %s.\n"),
-                char_to_tstring(kernel_name).c_str(), RGY_CSP_NAMES[pInputPlane->csp], get_err_mes(err));
-            return err;
-        }
-    }
-    return RGY_ERR_NONE;
-}
-
-RGY_ERR RGYFilterEdgelevel::procFrame(RGYFrameInfo *pOutputFrame, const RGYFrameInfo *pInputFrame, RGYOpenCLQueue &queue, const std::vector<RGYOpenCLEvent> &wait_events, RGYOpenCLEvent *event) {
-    auto srcImage = m_cl->createImageFromFrameBuffer(*pInputFrame, true, CL_MEM_READ_ONLY, &m_srcImagePool);
-    if (!srcImage) {
-        AddMessage(RGY_LOG_ERROR, _T("Failed to create image for input frame.\n"));
-        return RGY_ERR_MEM_OBJECT_ALLOCATION_FAILURE;
-    }
-    for (int i = 0; i < RGY_CSP_PLANES[pOutputFrame->csp]; i++) {
-        auto planeDst = getPlane(pOutputFrame, (RGY_PLANE)i);
-        auto planeSrc = getPlane(&srcImage->frame, (RGY_PLANE)i);
-        const std::vector<RGYOpenCLEvent> &plane_wait_event = (i == 0) ? wait_events : std::vector<RGYOpenCLEvent>();
-        RGYOpenCLEvent *plane_event = (i == RGY_CSP_PLANES[pOutputFrame->csp] - 1) ? event : nullptr;
-        auto err = procPlane(&planeDst, &planeSrc, queue, plane_wait_event, plane_event);
-        if (err != RGY_ERR_NONE) {
-            AddMessage(RGY_LOG_ERROR, _T("Failed to denoise(edgelevel) frame(%d) %s: %s\n"), i, cl_errmes(err));
-            return err_cl_to_rgy(err);
-        }
-    }
-    return RGY_ERR_NONE;
-}
-
-RGYFilterEdgelevel::RGYFilterEdgelevel(shared_ptr<RGYOpenCLContext> context) : RGYFilter(context), m_edgelevel(), m_srcImagePool() {
-    m_name = _T("edgelevel");
-}
-
-RGYFilterEdgelevel::~RGYFilterEdgelevel() {
-    close();
-}
-
-RGY_ERR RGYFilterEdgelevel::init(shared_ptr<RGYFilterParam> pParam, shared_ptr<RGYLog> pPrintMes) {
-    RGY_ERR sts = RGY_ERR_NONE;
-    m_pLog = pPrintMes;
-    auto prm = std::dynamic_pointer_cast<RGYFilterParamEdgelevel>(pParam);
-    if (!prm) {
-        AddMessage(RGY_LOG_ERROR, _T("Invalid parameter type.\n"));
-        return RGY_ERR_INVALID_PARAM;
-    }
-    //パラメータチェック
-    if (prm->frameOut.height <= 0 || prm->frameOut.width <= 0) {
-        AddMessage(RGY_LOG_ERROR, _T("Invalid parameter.\n"));
-        return RGY_ERR_INVALID_PARAM;
-    }
-    if (prm->edgelevel.strength < -31.0f || 31.0f < prm->edgelevel.strength) {
-        prm->edgelevel.strength = clamp(prm->edgelevel.strength, -31.0f, 31.0f);
-        AddMessage(RGY_LOG_WARN, _T("strength should be in range of %.1f - %.1f.\n"), -31.0f, 31.0f);
-    }
-    if (prm->edgelevel.threshold < 0.0f || 255.0f < prm->edgelevel.threshold) {
-        prm->edgelevel.threshold = clamp(prm->edgelevel.threshold, 0.0f, 255.0f);
-        AddMessage(RGY_LOG_WARN, _T("threshold should be in range of %.1f - %.1f.\n"), 0.0f, 255.0f);
-    }
-    if (prm->edgelevel.black < 0.0f || 31.0f < prm->edgelevel.black) {
-        prm->edgelevel.black = clamp(prm->edgelevel.black, 0.0f, 31.0f);
-        AddMessage(RGY_LOG_WARN, _T("black should be in range of %.1f - %.1f.\n"), 0.0f, 31.0f);
-    }
-    if (prm->edgelevel.white < 0.0f || 31.0f < prm->edgelevel.white) {
-        prm->edgelevel.white = clamp(prm->edgelevel.white, 0.0f, 31.0f);
-        AddMessage(RGY_LOG_WARN, _T("white should be in range of %.1f - %.1f.\n"), 0.0f, 31.0f);
-    }
-    auto prmPrev = std::dynamic_pointer_cast<RGYFilterParamEdgelevel>(m_param);
-    if (!m_edgelevel.get()
-        || !prmPrev
-        || RGY_CSP_BIT_DEPTH[prmPrev->frameOut.csp] != RGY_CSP_BIT_DEPTH[pParam->frameOut.csp]) {
-        const auto options = strsprintf("-D Type=%s -D bit_depth=%d",
-            RGY_CSP_BIT_DEPTH[prm->frameOut.csp] > 8 ? "ushort" : "uchar",
-            RGY_CSP_BIT_DEPTH[prm->frameOut.csp]);
-        m_edgelevel.set(m_cl->buildResourceAsync(_T("RGY_FILTER_EDGELEVEL_CL"), _T("EXE_DATA"), options.c_str()));
-    }
-
-    auto err = AllocFrameBuf(prm->frameOut, 1);
-    if (err != RGY_ERR_NONE) {
-        AddMessage(RGY_LOG_ERROR, _T("failed to allocate memory: %s.\n"), get_err_mes(err));
-        return RGY_ERR_MEMORY_ALLOC;
-    }
-    for (int i = 0; i < RGY_CSP_PLANES[m_frameBuf[0]->frame.csp]; i++) {
-        prm->frameOut.pitch[i] = m_frameBuf[0]->frame.pitch[i];
-    }
-
-    //コピーを保存
-    setFilterInfo(prm->print());
-    m_param = prm;
-    return sts;
-}
-
-RGY_ERR RGYFilterEdgelevel::run_filter(const RGYFrameInfo *pInputFrame, RGYFrameInfo **ppOutputFrames, int *pOutputFrameNum, RGYOpenCLQueue &queue, const std::vector<RGYOpenCLEvent> &wait_events, RGYOpenCLEvent *event) {
-    RGY_ERR sts = RGY_ERR_NONE;
-    if (pInputFrame->ptr[0] == nullptr) {
-        return sts;
-    }
-
-    *pOutputFrameNum = 1;
-    if (ppOutputFrames[0] == nullptr) {
-        auto pOutFrame = m_frameBuf[0].get();
-        ppOutputFrames[0] = &pOutFrame->frame;
-    }
-    ppOutputFrames[0]->picstruct = pInputFrame->picstruct;
-    //if (interlaced(*pInputFrame)) {
-    //    return filter_as_interlaced_pair(pInputFrame, ppOutputFrames[0], cudaStreamDefault);
-    //}
-    if (!m_edgelevel.get()) {
-        AddMessage(RGY_LOG_ERROR, _T("failed to build RGY_FILTER_EDGELEVEL_CL(m_edgelevel)\n"));
-        return RGY_ERR_OPENCL_CRUSH;
-    }
-    const auto memcpyKind = getMemcpyKind(pInputFrame->mem_type, ppOutputFrames[0]->mem_type);
-    if (memcpyKind != RGYCLMemcpyD2D) {
-        AddMessage(RGY_LOG_ERROR, _T("only supported on device memory.\n"));
-        return RGY_ERR_UNSUPPORTED;
-    }
-    if (m_param->frameOut.csp != m_param->frameIn.csp) {
-        AddMessage(RGY_LOG_ERROR, _T("csp does not match.\n"));
-        return RGY_ERR_UNSUPPORTED;
-    }
-
-    sts = procFrame(ppOutputFrames[0], pInputFrame, queue, wait_events, event);
-    if (sts != RGY_ERR_NONE) {
-        AddMessage(RGY_LOG_ERROR, _T("error at denoiseFrame (%s): %s.\n"),
-            RGY_CSP_NAMES[pInputFrame->csp], get_err_mes(sts));
-        return sts;
-    }
-
-    return sts;
-}
-
-void RGYFilterEdgelevel::close() {
-    m_srcImagePool.clear();
-    m_frameBuf.clear();
-    m_edgelevel.clear();
-    m_cl.reset();
-    m_bInterlacedWarn = false;
-}
+﻿// -----------------------------------------------------------------------------------------
+// NVEnc by rigaya
+// -----------------------------------------------------------------------------------------
+//
+// The MIT License
+//
+// Copyright (c) 2014-2016 rigaya
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// ------------------------------------------------------------------------------------------
+
+#define _USE_MATH_DEFINES
+#include <cmath>
+#include <map>
+#include <array>
+#include "rgy_filter_edgelevel.h"
+
+RGY_ERR RGYFilterEdgelevel::procPlane(RGYFrameInfo *pOutputPlane, const RGYFrameInfo *pInputPlane, const int srcRead, RGYOpenCLQueue &queue, const std::vector<RGYOpenCLEvent> &wait_events, RGYOpenCLEvent *event) {
+    auto prm = std::dynamic_pointer_cast<RGYFilterParamEdgelevel>(m_param);
+    if (!prm) {
+        AddMessage(RGY_LOG_ERROR, _T("Invalid parameter type.\n"));
+        return RGY_ERR_INVALID_PARAM;
+    }
+    {
+        const float strength = prm->edgelevel.strength / (1 << 4);
+        const float threshold = prm->edgelevel.threshold / (1 << (RGY_CSP_BIT_DEPTH[pInputPlane->csp] - 1));
+        const float black = prm->edgelevel.black / (1 << RGY_CSP_BIT_DEPTH[pInputPlane->csp]);
+        const float white = prm->edgelevel.white / (1 << RGY_CSP_BIT_DEPTH[pInputPlane->csp]);
+        const char *kernel_name = "kernel_edgelevel";
+        RGYWorkSize local(32, 8);
+        RGYWorkSize global(pOutputPlane->width, pOutputPlane->height);
+        auto err = m_edgelevel[srcRead].get()->kernel(kernel_name).config(queue, local, global, wait_events, event).tunable().launch(
+            (cl_mem)pOutputPlane->ptr[0], pOutputPlane->pitch[0], pOutputPlane->width, pOutputPlane->height,
+            (cl_mem)pInputPlane->ptr[0], pInputPlane->pitch[0],
+            strength, threshold, black, white);
+        if (err != RGY_ERR_NONE) {
+            AddMessage(RGY_LOG_ERROR, _T("error at %s (procPlane(%s)): %s.\n"),
+                char_to_tstring(kernel_name).c_str(), RGY_CSP_NAMES[pInputPlane->csp], get_err_mes(err));
+            return err;
+        }
+    }
+    return RGY_ERR_NONE;
+}
+
+RGY_ERR RGYFilterEdgelevel::procFrame(RGYFrameInfo *pOutputFrame, const RGYFrameInfo *pInputFrame, const int srcRead, RGYOpenCLQueue &queue, const std::vector<RGYOpenCLEvent> &wait_events, RGYOpenCLEvent *event) {
+    std::unique_ptr<RGYCLFrame, RGYCLImageFromBufferDeleter> srcImage;
+    const RGYFrameInfo *pSrcFrame = pInputFrame;
+    if (srcRead == RGY_FILTER_SRC_IMAGE) {
+        srcImage = m_cl->createImageFromFrameBuffer(*pInputFrame, true, CL_MEM_READ_ONLY, &m_srcImagePool);
+        if (!srcImage) {
+            AddMessage(RGY_LOG_ERROR, _T("Failed to create image for input frame.\n"));
+            return RGY_ERR_MEM_OBJECT_ALLOCATION_FAILURE;
+        }
+        pSrcFrame = &srcImage->frame;
+    }
+    for (int i = 0; i < RGY_CSP_PLANES[pOutputFrame->csp]; i++) {
+        auto planeDst = getPlane(pOutputFrame, (RGY_PLANE)i);
+        auto planeSrc = getPlane(pSrcFrame, (RGY_PLANE)i);
+        const std::vector<RGYOpenCLEvent> &plane_wait_event = (i == 0) ? wait_events : std::vector<RGYOpenCLEvent>();
+        RGYOpenCLEvent *plane_event = (i == RGY_CSP_PLANES[pOutputFrame->csp] - 1) ? event : nullptr;
+        auto err = procPlane(&planeDst, &planeSrc, srcRead, queue, plane_wait_event, plane_event);
+        if (err != RGY_ERR_NONE) {
+            AddMessage(RGY_LOG_ERROR, _T("Failed to denoise(edgelevel) frame(%d) %s: %s\n"), i, cl_errmes(err));
+            return err_cl_to_rgy(err);
+        }
+    }
+    return RGY_ERR_NONE;
+}
+
+RGYFilterEdgelevel::RGYFilterEdgelevel(shared_ptr<RGYOpenCLContext> context) : RGYFilter(context), m_edgelevel(), m_srcImagePool() {
+    m_name = _T("edgelevel");
+}
+
+RGYFilterEdgelevel::~RGYFilterEdgelevel() {
+    close();
+}
+
+RGY_ERR RGYFilterEdgelevel::init(shared_ptr<RGYFilterParam> pParam, shared_ptr<RGYLog> pPrintMes) {
+    RGY_ERR sts = RGY_ERR_NONE;
+    m_pLog = pPrintMes;
+    auto prm = std::dynamic_pointer_cast<RGYFilterParamEdgelevel>(pParam);
+    if (!prm) {
+        AddMessage(RGY_LOG_ERROR, _T("Invalid parameter type.\n"));
+        return RGY_ERR_INVALID_PARAM;
+    }
+    //パラメータチェック
+    if (prm->frameOut.height <= 0 || prm->frameOut.width <= 0) {
+        AddMessage(RGY_LOG_ERROR, _T("Invalid parameter.\n"));
+        return RGY_ERR_INVALID_PARAM;
+    }
+    if (prm->edgelevel.strength < -31.0f || 31.0f < prm->edgelevel.strength) {
+        prm->edgelevel.strength = clamp(prm->edgelevel.strength, -31.0f, 31.0f);
+        AddMessage(RGY_LOG_WARN, _T("strength should be in range of %.1f - %.1f.\n"), -31.0f, 31.0f);
+    }
+    if (prm->edgelevel.threshold < 0.0f || 255.0f < prm->edgelevel.threshold) {
+        prm->edgelevel.threshold = clamp(prm->edgelevel.threshold, 0.0f, 255.0f);
+        AddMessage(RGY_LOG_WARN, _T("threshold should be in range of %.1f - %.1f.\n"), 0.0f, 255.0f);
+    }
+    if (prm->edgelevel.black < 0.0f || 31.0f < prm->edgelevel.black) {
+        prm->edgelevel.black = clamp(prm->edgelevel.black, 0.0f, 31.0f);
+        AddMessage(RGY_LOG_WARN, _T("black should be in range of %.1f - %.1f.\n"), 0.0f, 31.0f);
+    }
+    if (prm->edgelevel.white < 0.0f || 31.0f < prm->edgelevel.white) {
+        prm->edgelevel.white = clamp(prm->edgelevel.white, 0.0f, 31.0f);
+        AddMessage(RGY_LOG_WARN, _T("white should be in range of %.1f - %.1f.\n"), 0.0f, 31.0f);
+    }
+    auto prmPrev = std::dynamic_pointer_cast<RGYFilterParamEdgelevel>(m_param);
+    const auto options = strsprintf("-D Type=%s -D bit_depth=%d",
+        RGY_CSP_BIT_DEPTH[prm->frameOut.csp] > 8 ? "ushort" : "uchar",
+        RGY_CSP_BIT_DEPTH[prm->frameOut.csp]);
+    const bool rebuild = !prmPrev
+        || RGY_CSP_BIT_DEPTH[prmPrev->frameOut.csp] != RGY_CSP_BIT_DEPTH[pParam->frameOut.csp];
+    //入力の読み込み方法ごとにビルドする
+    //strength, threshold, black, whiteを定数として埋め込んだ特殊化版は、バックグラウンドでビルドする
+    const float strength = prm->edgelevel.strength / (1 << 4);
+    const float threshold = prm->edgelevel.threshold / (1 << (RGY_CSP_BIT_DEPTH[prm->frameOut.csp] - 1));
+    const float black = prm->edgelevel.black / (1 << RGY_CSP_BIT_DEPTH[prm->frameOut.csp]);
+    const float white = prm->edgelevel.white / (1 << RGY_CSP_BIT_DEPTH[prm->frameOut.csp]);
+    const auto srcReads = srcReadCandidates(prm->frameIn);
+    for (int srcRead = 0; srcRead < RGY_FILTER_SRC_READ_COUNT; srcRead++) {
+        if (std::find(srcReads.begin(), srcReads.end(), srcRead) == srcReads.end()) {
+            if (rebuild) {
+                m_edgelevel[srcRead].clear();
+            }
+            continue;
+        }
+        const auto optionsSrcRead = options + strsprintf(" -D SRC_IMAGE=%d", (srcRead == RGY_FILTER_SRC_IMAGE) ? 1 : 0);
+        const auto optionsGeneric = optionsSrcRead
+            + RGYOpenCLProgramSpecialized::genericParam("strength")
+            + RGYOpenCLProgramSpecialized::genericParam("threshold")
+            + RGYOpenCLProgramSpecialized::genericParam("black")
+            + RGYOpenCLProgramSpecialized::genericParam("white");
+        if (rebuild || !m_edgelevel[srcRead].valid()) {
+            m_edgelevel[srcRead].setGeneric(m_cl->buildResourceAsync(_T("RGY_FILTER_EDGELEVEL_CL"), _T("EXE_DATA"), optionsGeneric.c_str()));
+        }
+        const auto optionsSpecialized = optionsSrcRead
+            + RGYOpenCLProgramSpecialized::specializedParam("strength", strength)
+            + RGYOpenCLProgramSpecialized::specializedParam("threshold", threshold)
+            + RGYOpenCLProgramSpecialized::specializedParam("black", black)
+            + RGYOpenCLProgramSpecialized::specializedParam("white", white);
+        if (m_edgelevel[srcRead].specializationChanged(optionsSpecialized)) {
+            m_edgelevel[srcRead].setSpecialized(optionsSpecialized, m_cl->buildResourceAsync(_T("RGY_FILTER_EDGELEVEL_CL"), _T("EXE_DATA"), optionsSpecialized.c_str()));
+        }
+    }
+
+    if (prm->bOutOverwrite) {
+        //入力フレームに上書きするので、出力バッファは不要
+        m_frameBuf.clear();
+        prm->frameOut = prm->frameIn;
+    } else {
+        auto err = AllocFrameBuf(prm->frameOut, 1);
+        if (err != RGY_ERR_NONE) {
+            AddMessage(RGY_LOG_ERROR, _T("failed to allocate memory: %s.\n"), get_err_mes(err));
+            return RGY_ERR_MEMORY_ALLOC;
+        }
+        for (int i = 0; i < RGY_CSP_PLANES[m_frameBuf[0]->frame.csp]; i++) {
+            prm->frameOut.pitch[i] = m_frameBuf[0]->frame.pitch[i];
+        }
+    }
+
+    //コピーを保存
+    setFilterInfo(prm->print());
+    m_param = prm;
+    return sts;
+}
+
+RGY_ERR RGYFilterEdgelevel::run_filter(const RGYFrameInfo *pInputFrame, RGYFrameInfo **ppOutputFrames, int *pOutputFrameNum, RGYOpenCLQueue &queue, const std::vector<RGYOpenCLEvent> &wait_events, RGYOpenCLEvent *event) {
+    RGY_ERR sts = RGY_ERR_NONE;
+    if (pInputFrame->ptr[0] == nullptr) {
+        return sts;
+    }
+
+    *pOutputFrameNum = 1;
+    if (ppOutputFrames[0] == nullptr) {
+        auto pOutFrame = m_frameBuf[0].get();
+        ppOutputFrames[0] = &pOutFrame->frame;
+    }
+    ppOutputFrames[0]->picstruct = pInputFrame->picstruct;
+    //if (interlaced(*pInputFrame)) {
+    //    return filter_as_interlaced_pair(pInputFrame, ppOutputFrames[0], cudaStreamDefault);
+    //}
+    int trial = -1;
+    const int srcRead = selectSrcRead(queue, *pInputFrame, trial);
+    if (!m_edgelevel[srcRead].get(queue)) {
+        AddMessage(RGY_LOG_ERROR, _T("failed to build RGY_FILTER_EDGELEVEL_CL(m_edgelevel)\n"));
+        return RGY_ERR_OPENCL_CRUSH;
+    }
+    const auto memcpyKind = getMemcpyKind(pInputFrame->mem_type, ppOutputFrames[0]->mem_type);
+    if (memcpyKind != RGYCLMemcpyD2D) {
+        AddMessage(RGY_LOG_ERROR, _T("only supported on device memory.\n"));
+        return RGY_ERR_UNSUPPORTED;
+    }
+    if (m_param->frameOut.csp != m_param->frameIn.csp) {
+        AddMessage(RGY_LOG_ERROR, _T("csp does not match.\n"));
+        return RGY_ERR_UNSUPPORTED;
+    }
+
+    sts = runSrcRead(queue, *pInputFrame, trial, [&]() {
+        return procFrame(ppOutputFrames[0], pInputFrame, srcRead, queue, wait_events, event);
+    });
+    if (sts != RGY_ERR_NONE) {
+        AddMessage(RGY_LOG_ERROR, _T("error at denoiseFrame (%s): %s.\n"),
+            RGY_CSP_NAMES[pInputFrame->csp], get_err_mes(sts));
+        return sts;
+    }
+
+    return sts;
+}
+
+void RGYFilterEdgelevel::close() {
+    m_srcImagePool.clear();
+    m_frameBuf.clear();
+    for (auto& edgelevel : m_edgelevel) {
+        edgelevel.clear();
+    }
+    m_cl.reset();
+    m_bInterlacedWarn = false;
+}
@@ -1,51 +1,71 @@
-﻿// Type
-// radius
-// bit_depth
-
-#ifndef clamp
-#define clamp(x, low, high) (((x) <= (high)) ? (((x) >= (low)) ? (x) : (low)) : (high))
-#endif
-
-#define SHARED_SIZE ((2 * radius + 1) * (2 * radius + 1))
-
-#define RGY_FLT_EPS (1e-6f)
-
-__kernel void kernel_unsharp(
-    __global uchar *__restrict__ pDst,
-    const int dstPitch, const int dstWidth, const int dstHeight,
-    __read_only image2d_t texSrc,
-    const __global float *__restrict__ pGaussWeight,
-    const float weight, const float threshold) {
-    const int ix = get_global_id(0);
-    const int iy = get_global_id(1);
-    const sampler_t sampler = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_CLAMP_TO_EDGE | CLK_FILTER_NEAREST;
-
-    const int local_id = get_local_id(1) * get_local_size(0) + get_local_id(0);
-    __local float shared[SHARED_SIZE];
-    if (local_id < SHARED_SIZE) {
-        shared[local_id] = pGaussWeight[local_id];
-    }
-    barrier(CLK_LOCAL_MEM_FENCE);
-
-    if (ix < dstWidth && iy < dstHeight) {
-        float sum = 0.0f;
-        float center = (float)read_imagef(texSrc, sampler, (int2)(ix, iy)).x;
-        __local float *ptr_weight = shared;
-
-        for (int j = -radius; j <= radius; j++) {
-            #pragma unroll
-            for (int i = -radius; i <= radius; i++) {
-                sum += (float)read_imagef(texSrc, sampler, (int2)(ix+i, iy+j)).x * ptr_weight[0];
-                ptr_weight++;
-            }
-        }
-
-        const float diff = center - sum;
-        if (fabs(diff) >= threshold) {
-            center += weight * diff;
-        }
-
-        __global Type *ptr = (__global Type *)(pDst + iy * dstPitch + ix * sizeof(Type));
-        ptr[0] = (Type)(clamp(center, 0.0f, 1.0f - RGY_FLT_EPS) * (1 << (bit_depth)));
-    }
-}
+﻿// Type
+// radius
+// bit_depth
+// SRC_IMAGE
+// weight_const    (汎用版ではweight_arg)
+// threshold_const (汎用版ではthreshold_arg)
+
+#ifndef clamp
+#define clamp(x, low, high) (((x) <= (high)) ? (((x) >= (low)) ? (x) : (low)) : (high))
+#endif
+
+#define SHARED_SIZE ((2 * radius + 1) * (2 * radius + 1))
+
+#define RGY_FLT_EPS (1e-6f)
+
+#if SRC_IMAGE
+#define SRC_PARAM __read_only image2d_t texSrc
+#define LOAD_SRC(x, y) (float)read_imagef(texSrc, sampler, (int2)(x, y)).x
+#else
+//imageを使わない場合は、バッファから直接読み込み、imageと同様に端の画素で補って[0,1]に正規化する
+#define SRC_PARAM const __global uchar *__restrict__ pSrc
+#define LOAD_SRC(x, y) load_src(pSrc, srcPitch, dstWidth, dstHeight, (x), (y))
+float load_src(const __global uchar *__restrict__ pSrc, const int srcPitch, const int width, const int height, int x, int y) {
+    x = clamp(x, 0, width - 1);
+    y = clamp(y, 0, height - 1);
+    const __global Type *ptr = (const __global Type *)(pSrc + y * srcPitch + x * sizeof(Type));
+    return (float)ptr[0] * (1.0f / (float)((1 << (sizeof(Type) * 8)) - 1));
+}
+#endif
+
+__kernel void kernel_unsharp(
+    __global uchar *__restrict__ pDst,
+    const int dstPitch, const int dstWidth, const int dstHeight,
+    SRC_PARAM, const int srcPitch,
+    const __global float *__restrict__ pGaussWeight,
+    const float weight_arg, const float threshold_arg) {
+    const float weight = weight_const;
+    const float threshold = threshold_const;
+    const int ix = get_global_id(0);
+    const int iy = get_global_id(1);
+    const sampler_t sampler = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_CLAMP_TO_EDGE | CLK_FILTER_NEAREST;
+
+    const int local_id = get_local_id(1) * get_local_size(0) + get_local_id(0);
+    __local float shared[SHARED_SIZE];
+    if (local_id < SHARED_SIZE) {
+        shared[local_id] = pGaussWeight[local_id];
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    if (ix < dstWidth && iy < dstHeight) {
+        float sum = 0.0f;
+        float center = LOAD_SRC(ix, iy);
+        __local float *ptr_weight = shared;
+
+        for (int j = -radius; j <= radius; j++) {
+            #pragma unroll
+            for (int i = -radius; i <= radius; i++) {
+                sum += LOAD_SRC(ix+i, iy+j) * ptr_weight[0];
+                ptr_weight++;
+            }
+        }
+
+        const float diff = center - sum;
+        if (fabs(diff) >= threshold) {
+            center += weight * diff;
+        }
+
+        __global Type *ptr = (__global Type *)(pDst + iy * dstPitch + ix * sizeof(Type));
+        ptr[0] = (Type)(clamp(center, 0.0f, 1.0f - RGY_FLT_EPS) * (1 << (bit_depth)));
+    }
+}
@@ -1,643 +1,1036 @@
-﻿// -----------------------------------------------------------------------------------------
-// clfilters by rigaya
-// -----------------------------------------------------------------------------------------
-//
-// The MIT License
-//
-// Copyright (c) 2022-2024 rigaya
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-// ------------------------------------------------------------------------------------------
-
-#include "clcufilters_version.h"
-#include "clfilters_chain.h"
-#include "clcufilters_chain_prm.h"
-#include "rgy_cmd.h"
-#include "rgy_filter_colorspace.h"
-#include "rgy_filter_nnedi.h"
-#include "rgy_filter_denoise_knn.h"
-#include "rgy_filter_denoise_nlmeans.h"
-#include "rgy_filter_denoise_pmd.h"
-#include "rgy_filter_denoise_dct.h"
-#include "rgy_filter_libplacebo.h"
-#include "rgy_filter_smooth.h"
-#include "rgy_filter_unsharp.h"
-#include "rgy_filter_resize.h"
-#include "rgy_filter_edgelevel.h"
-#include "rgy_filter_warpsharp.h"
-#include "rgy_filter_deband.h"
-#include "rgy_filter_tweak.h"
-#include "rgy_device.h"
-
-static tstring luidToString(const void *uuid) {
-    tstring str;
-    const uint8_t *buf = (const uint8_t *)uuid;
-    for (size_t i = 0; i < CL_LUID_SIZE_KHR; ++i) {
-        char tmp[4];
-        _stprintf_s(tmp, "%02x", buf[i]);
-        str += tmp;
-    }
-    return str;
-};
-
-clFilterFrameBuffer::clFilterFrameBuffer(std::shared_ptr<RGYOpenCLContext> cl) :
-    clcuFilterFrameBuffer(),
-    m_cl(cl) {
-
-}
-
-clFilterFrameBuffer::~clFilterFrameBuffer() {
-    freeFrames();
-}
-
-std::unique_ptr<RGYFrame> clFilterFrameBuffer::allocateFrame(const int width, const int height) {
-    return m_cl->createFrameBuffer(width, height, RGY_CSP_YUV444_16, 16, CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR);
-}
-
-void clFilterFrameBuffer::resetMappedFrame(RGYFrame *frame) {
-    if (auto clFrame = dynamic_cast<RGYCLFrame *>(frame); clFrame) {
-        clFrame->resetMappedFrame();
-    }
-}
-
-clFilterChain::clFilterChain() :
-    clcuFilterChain(),
-    m_cl(),
-    m_dx11(),
-    m_platformID(-1),
-    m_queueSendIn() {
-
-}
-
-clFilterChain::~clFilterChain() {
-    close();
-}
-
-void clFilterChain::close() {
-    m_filters.clear();
-    m_frameIn.reset();
-    m_queueSendIn.finish(); // m_frameIn.reset() のあと
-    m_queueSendIn.clear();  // m_frameIn.reset() のあと
-    m_frameOut.reset();
-    m_cl.reset();
-    m_deviceName.clear();
-    m_convert_yc48_to_yuv444_16.reset();
-    m_convert_yuv444_16_to_yc48.reset();
-    m_log.reset();
-    m_platformID = -1;
-    m_deviceID = -1;
-}
-
-RGY_ERR clFilterChain::initDevice(const clcuFilterDeviceParam *param) {
-    auto prm = dynamic_cast<const clFilterDeviceParam *>(param);
-    const int platformID = prm->platformID;
-    const int deviceID = prm->deviceID;
-    const cl_device_type device_type = prm->deviceType;
-    PrintMes(RGY_LOG_INFO, _T("start init OpenCL platform %d, device %d\n"), platformID, deviceID);
-
-    RGYOpenCL cl(m_log);
-    auto platforms = cl.getPlatforms(nullptr);
-    if (platforms.size() == 0) {
-        PrintMes(RGY_LOG_ERROR, _T("No OpenCL Platform found on this system.\n"));
-        return RGY_ERR_DEVICE_NOT_FOUND;
-    }
-    if (prm->noNVCL) {
-        PrintMes(RGY_LOG_DEBUG, _T("noNVCL = true.\n"));
-        for (auto it = platforms.begin(); it != platforms.end();) {
-            if ((*it)->isVendor("NVIDIA")) {
-                it = platforms.erase(it);
-            } else {
-                it++;
-            }
-        }
-    }
-
-    if (platformID >= 0 && platformID >= (int)platforms.size()) {
-        PrintMes(RGY_LOG_ERROR, _T("platform %d does not exist (platform count = %d)\n"), platformID, (int)platforms.size());
-        return RGY_ERR_DEVICE_NOT_FOUND;
-    }
-    PrintMes(RGY_LOG_INFO, _T("OpenCL platform count %d\n"), (int)platforms.size());
-
-    auto& platform = platforms[std::max(platformID, 0)];
-
-    auto err = err_cl_to_rgy(platform->createDeviceList(device_type));
-    if (err != RGY_ERR_NONE) {
-        PrintMes(RGY_LOG_ERROR, _T("Failed to create device list: %s\n"), get_err_mes(err));
-        return RGY_ERR_DEVICE_NOT_FOUND;
-    }
-    PrintMes(RGY_LOG_INFO, _T("created device list: %d device(s).\n"), platform->devs().size());
-
-    if (deviceID >= 0 && deviceID >= (int)platform->devs().size()) {
-        PrintMes(RGY_LOG_ERROR, _T("Invalid device Id %d (device count %d)\n"), deviceID, (int)platform->devs().size());
-        return RGY_ERR_INVALID_DEVICE;
-    }
-
-    uint8_t devLUID[CL_LUID_SIZE_KHR];
-    memcpy(devLUID, platform->dev(std::max(deviceID, 0)).info().luid, sizeof(devLUID));
-    PrintMes(RGY_LOG_INFO, _T("created OpenCL context, selcted device %d, LUID=%s.\n"), deviceID, luidToString(devLUID).c_str());
-
-    const int dx11AdaptorCount = DeviceDX11::adapterCount();
-    for (int iadaptor = 0; iadaptor < dx11AdaptorCount; iadaptor++) {
-        auto dx11 = std::make_unique<DeviceDX11>();
-        err = dx11->Init(iadaptor, m_log);
-        if (err != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_DEBUG, _T("Failed to init DX11 device #%d: %s\n"), iadaptor, get_err_mes(err));
-            return err;
-        }
-        const auto dx11UUID = dx11->getLUID();
-        PrintMes(RGY_LOG_DEBUG, _T("Initialized DX11 device %d, LUID=%s.\n"), deviceID, luidToString(&dx11UUID).c_str());
-
-        if (memcmp(&dx11UUID, devLUID, sizeof(dx11UUID)) == 0) {
-            m_dx11 = std::move(dx11);
-            PrintMes(RGY_LOG_INFO, _T("Selected DX11 device %d.\n"), deviceID, luidToString(devLUID).c_str());
-            break;
-        }
-    }
-    if (m_dx11) {
-        if (platform->createDeviceListD3D11(CL_DEVICE_TYPE_GPU, m_dx11->GetDevice()) != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_WARN, _T("Failed to create OpenCL device list from DX11 device.\n"));
-            m_dx11.reset();
-        }
-    }
-    if (!m_dx11) {
-        platform->setDev(platform->devs()[std::max(deviceID, 0)], nullptr, m_dx11->GetDevice());
-    }
-    m_cl = std::make_shared<RGYOpenCLContext>(platform, m_log);
-    if (m_cl->createContext(0) != RGY_ERR_NONE) {
-        PrintMes(RGY_LOG_ERROR, _T("Failed to create OpenCL context.\n"));
-        return RGY_ERR_UNKNOWN;
-    }
-    const auto& devInfo = platform->dev(0).info();
-
-    m_deviceName = (devInfo.board_name_amd.length() > 0) ? devInfo.board_name_amd : devInfo.name;
-    m_platformID = platformID;
-    m_deviceID = deviceID;
-    m_queueSendIn = m_cl->createQueue(platform->dev(0).id(), 0 /*CL_QUEUE_PROFILING_ENABLE*/);
-
-    m_frameIn = std::make_unique<clFilterFrameBuffer>(m_cl);
-    m_frameOut = std::make_unique<clFilterFrameBuffer>(m_cl);
-
-    PrintMes(RGY_LOG_INFO, _T("created OpenCL context, selcted device %s.\n"), m_deviceName.c_str());
-    return RGY_ERR_NONE;
-}
-
-RGY_ERR clFilterChain::configureOneFilter(std::unique_ptr<RGYFilterBase>& filter, RGYFrameInfo& inputFrame, const VppType filterType, const int resizeWidth, const int resizeHeight) {
-    // colorspace
-    if (filterType == VppType::CL_COLORSPACE) {
-        if (!filter) {
-            //フィルタチェーンに追加
-            filter.reset(new RGYFilterColorspace(m_cl));
-        }
-        std::shared_ptr<RGYFilterParamColorspace> param(new RGYFilterParamColorspace());
-        param->colorspace = m_prm.vpp.colorspace;
-        param->frameIn = inputFrame;
-        param->frameOut = inputFrame;
-        param->bOutOverwrite = false;
-        auto sts = filter->init(param, m_log);
-        if (sts != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("failed to init colorspace.\n"));
-            return sts;
-        }
-        //入力フレーム情報を更新
-        inputFrame = param->frameOut;
-    }
-    // libplacebo-tonemap
-    if (filterType == VppType::CL_LIBPLACEBO_TONEMAP) {
-        if (!filter) {
-            //フィルタチェーンに追加
-            filter.reset(new RGYFilterLibplaceboToneMapping(m_cl));
-        }
-        std::shared_ptr<RGYFilterParamLibplaceboToneMapping> param(new RGYFilterParamLibplaceboToneMapping());
-        param->toneMapping = m_prm.vpp.libplacebo_tonemapping;
-        param->frameIn = inputFrame;
-        param->frameOut = inputFrame;
-        param->bOutOverwrite = false;
-        auto sts = filter->init(param, m_log);
-        if (sts != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("failed to init libplacebo-tonemap.\n"));
-            return sts;
-        }
-        //入力フレーム情報を更新
-        inputFrame = param->frameOut;
-    }
-    // nnedi
-    if (filterType == VppType::CL_NNEDI) {
-        if (!filter) {
-            //フィルタチェーンに追加
-            filter.reset(new RGYFilterNnedi(m_cl));
-        }
-        std::shared_ptr<RGYFilterParamNnedi> param(new RGYFilterParamNnedi());
-        param->nnedi = m_prm.vpp.nnedi;
-        param->hModule = nullptr;
-        param->frameIn = inputFrame;
-        param->frameOut = inputFrame;
-        param->timebase = rgy_rational<int>(); // bobで使用するが、clfiltersではbobはサポートしない
-        param->bOutOverwrite = false;
-        auto sts = filter->init(param, m_log);
-        if (sts != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("failed to init nnedi.\n"));
-            return sts;
-        }
-        //入力フレーム情報を更新
-        inputFrame = param->frameOut;
-    }
-    //ノイズ除去 (knn)
-    if (filterType == VppType::CL_DENOISE_KNN) {
-        if (!filter) {
-            //フィルタチェーンに追加
-            filter.reset(new RGYFilterDenoiseKnn(m_cl));
-        }
-        std::shared_ptr<RGYFilterParamDenoiseKnn> param(new RGYFilterParamDenoiseKnn());
-        param->knn = m_prm.vpp.knn;
-        param->frameIn = inputFrame;
-        param->frameOut = inputFrame;
-        param->bOutOverwrite = false;
-        auto sts = filter->init(param, m_log);
-        if (sts != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("failed to init knn.\n"));
-            return sts;
-        }
-        //入力フレーム情報を更新
-        inputFrame = param->frameOut;
-    }
-    //ノイズ除去 (nlmeans)
-    if (filterType == VppType::CL_DENOISE_NLMEANS) {
-        if (!filter) {
-            //フィルタチェーンに追加
-            filter.reset(new RGYFilterDenoiseNLMeans(m_cl));
-        }
-        std::shared_ptr<RGYFilterParamDenoiseNLMeans> param(new RGYFilterParamDenoiseNLMeans());
-        param->nlmeans = m_prm.vpp.nlmeans;
-        param->frameIn = inputFrame;
-        param->frameOut = inputFrame;
-        param->bOutOverwrite = false;
-        auto sts = filter->init(param, m_log);
-        if (sts != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("failed to init nlmeans.\n"));
-            return sts;
-        }
-        //入力フレーム情報を更新
-        inputFrame = param->frameOut;
-    }
-    //ノイズ除去 (pmd)
-    if (filterType == VppType::CL_DENOISE_PMD) {
-        if (!filter) {
-            //フィルタチェーンに追加
-            filter.reset(new RGYFilterDenoisePmd(m_cl));
-        }
-        std::shared_ptr<RGYFilterParamDenoisePmd> param(new RGYFilterParamDenoisePmd());
-        param->pmd = m_prm.vpp.pmd;
-        param->frameIn = inputFrame;
-        param->frameOut = inputFrame;
-        param->bOutOverwrite = false;
-        auto sts = filter->init(param, m_log);
-        if (sts != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("failed to init pmd.\n"));
-            return sts;
-        }
-        //入力フレーム情報を更新
-        inputFrame = param->frameOut;
-    }
-    //ノイズ除去 (smooth)
-    if (filterType == VppType::CL_DENOISE_DCT) {
-        if (!filter) {
-            //フィルタチェーンに追加
-            filter.reset(new RGYFilterDenoiseDct(m_cl));
-        }
-        std::shared_ptr<RGYFilterParamDenoiseDct> param(new RGYFilterParamDenoiseDct());
-        param->dct = m_prm.vpp.dct;
-        param->frameIn = inputFrame;
-        param->frameOut = inputFrame;
-        param->bOutOverwrite = false;
-        auto sts = filter->init(param, m_log);
-        if (sts != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("failed to init smooth.\n"));
-            return sts;
-        }
-        //入力フレーム情報を更新
-        inputFrame = param->frameOut;
-    }
-    //ノイズ除去 (smooth)
-    if (filterType == VppType::CL_DENOISE_SMOOTH) {
-        if (!filter) {
-            //フィルタチェーンに追加
-            filter.reset(new RGYFilterSmooth(m_cl));
-        }
-        std::shared_ptr<RGYFilterParamSmooth> param(new RGYFilterParamSmooth());
-        param->smooth = m_prm.vpp.smooth;
-        param->frameIn = inputFrame;
-        param->frameOut = inputFrame;
-        param->bOutOverwrite = false;
-        auto sts = filter->init(param, m_log);
-        if (sts != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("failed to init smooth.\n"));
-            return sts;
-        }
-        //入力フレーム情報を更新
-        inputFrame = param->frameOut;
-    }
-
-    //リサイズ
-    if (filterType == VppType::CL_RESIZE) {
-        if (!filter) {
-            //フィルタチェーンに追加
-            filter.reset(new RGYFilterResize(m_cl));
-        }
-        std::shared_ptr<RGYFilterParamResize> param(new RGYFilterParamResize());
-        param->interp = m_prm.vpp.resize_algo;
-        param->frameIn = inputFrame;
-        param->frameOut = inputFrame;
-        param->frameOut.width = resizeWidth;
-        param->frameOut.height = resizeHeight;
-        if (isLibplaceboResizeFiter(m_prm.vpp.resize_algo)) {
-            param->libplaceboResample = std::make_shared<RGYFilterParamLibplaceboResample>();
-            param->libplaceboResample->resample = m_prm.vpp.resize_libplacebo;
-            //param->libplaceboResample->vui = VuiFiltered;
-            //param->libplaceboResample->dx11 = m_dx11.get();
-            //param->libplaceboResample->vk = m_dev->vulkan();
-            param->libplaceboResample->resize_algo = m_prm.vpp.resize_algo;
-        }
-        param->bOutOverwrite = false;
-        auto sts = filter->init(param, m_log);
-        if (sts != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("failed to init resize.\n"));
-            return sts;
-        }
-        //入力フレーム情報を更新
-        inputFrame = param->frameOut;
-    }
-    //unsharp
-    if (filterType == VppType::CL_UNSHARP) {
-        if (!filter) {
-            //フィルタチェーンに追加
-            filter.reset(new RGYFilterUnsharp(m_cl));
-        }
-        std::shared_ptr<RGYFilterParamUnsharp> param(new RGYFilterParamUnsharp());
-        param->unsharp = m_prm.vpp.unsharp;
-        param->frameIn = inputFrame;
-        param->frameOut = inputFrame;
-        param->bOutOverwrite = false;
-        auto sts = filter->init(param, m_log);
-        if (sts != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("failed to init unsharp.\n"));
-            return sts;
-        }
-        //入力フレーム情報を更新
-        inputFrame = param->frameOut;
-    }
-    //edgelevel
-    if (filterType == VppType::CL_EDGELEVEL) {
-        if (!filter) {
-            //フィルタチェーンに追加
-            filter.reset(new RGYFilterEdgelevel(m_cl));
-        }
-        std::shared_ptr<RGYFilterParamEdgelevel> param(new RGYFilterParamEdgelevel());
-        param->edgelevel = m_prm.vpp.edgelevel;
-        param->frameIn = inputFrame;
-        param->frameOut = inputFrame;
-        param->bOutOverwrite = false;
-        auto sts = filter->init(param, m_log);
-        if (sts != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("failed to init edgelevel.\n"));
-            return sts;
-        }
-        //入力フレーム情報を更新
-        inputFrame = param->frameOut;
-    }
-    //warpsharp
-    if (filterType == VppType::CL_WARPSHARP) {
-        if (!filter) {
-            //フィルタチェーンに追加
-            filter.reset(new RGYFilterWarpsharp(m_cl));
-        }
-        std::shared_ptr<RGYFilterParamWarpsharp> param(new RGYFilterParamWarpsharp());
-        param->warpsharp = m_prm.vpp.warpsharp;
-        param->frameIn = inputFrame;
-        param->frameOut = inputFrame;
-        param->bOutOverwrite = false;
-        auto sts = filter->init(param, m_log);
-        if (sts != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("failed to init warpsharp.\n"));
-            return sts;
-        }
-        //入力フレーム情報を更新
-        inputFrame = param->frameOut;
-    }
-    //tweak
-    if (filterType == VppType::CL_TWEAK) {
-        if (!filter) {
-            //フィルタチェーンに追加
-            filter.reset(new RGYFilterTweak(m_cl));
-        }
-        std::shared_ptr<RGYFilterParamTweak> param(new RGYFilterParamTweak());
-        param->tweak = m_prm.vpp.tweak;
-        param->frameIn = inputFrame;
-        param->frameOut = inputFrame;
-        param->bOutOverwrite = true;
-        auto sts = filter->init(param, m_log);
-        if (sts != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("failed to init tweak.\n"));
-            return sts;
-        }
-        //入力フレーム情報を更新
-        inputFrame = param->frameOut;
-    }
-    //deband
-    if (filterType == VppType::CL_DEBAND) {
-        if (!filter) {
-            //フィルタチェーンに追加
-            filter.reset(new RGYFilterDeband(m_cl));
-        }
-        std::shared_ptr<RGYFilterParamDeband> param(new RGYFilterParamDeband());
-        param->deband = m_prm.vpp.deband;
-        param->frameIn = inputFrame;
-        param->frameOut = inputFrame;
-        param->bOutOverwrite = false;
-        auto sts = filter->init(param, m_log);
-        if (sts != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("failed to init deband.\n"));
-            return sts;
-        }
-        //入力フレーム情報を更新
-        inputFrame = param->frameOut;
-    }
-    //libplacebo-deband
-    if (filterType == VppType::CL_LIBPLACEBO_DEBAND) {
-        if (!filter) {
-            //フィルタチェーンに追加
-            filter.reset(new RGYFilterLibplaceboDeband(m_cl));
-        }
-        std::shared_ptr<RGYFilterParamLibplaceboDeband> param(new RGYFilterParamLibplaceboDeband());
-        param->deband = m_prm.vpp.libplacebo_deband;
-        param->frameIn = inputFrame;
-        param->frameOut = inputFrame;
-        param->bOutOverwrite = false;
-        auto sts = filter->init(param, m_log);
-        if (sts != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("failed to init libplacebo-deband.\n"));
-            return sts;
-        }
-        //入力フレーム情報を更新
-        inputFrame = param->frameOut;
-    }
-
-    return RGY_ERR_NONE;
-}
-
-RGY_ERR clFilterChain::sendInFrame(const RGYFrameInfo *pInputFrame) {
-    if (!m_cl) {
-        return RGY_ERR_NULL_PTR;
-    }
-    auto frameDevIn = dynamic_cast<RGYCLFrame*>(m_frameIn->get_in(pInputFrame->width, pInputFrame->height));
-    if (!frameDevIn) {
-        return RGY_ERR_NULL_PTR;
-    }
-    m_frameIn->in_to_next();
-
-    auto err = frameDevIn->queueMapBuffer(m_queueSendIn, CL_MAP_WRITE /*CL_​MAP_​WRITE_​INVALIDATE_​REGION*/);
-    if (err != RGY_ERR_NONE) {
-        PrintMes(RGY_LOG_ERROR, _T("failed to queue map input buffer: %s.\n"), get_err_mes(err));
-        return err;
-    }
-    frameDevIn->mapWait();
-    copyFramePropWithoutCsp(&frameDevIn->frame, pInputFrame);
-
-    {
-        auto frameHostIn = frameDevIn->mappedHost();
-
-        //YC48->YUV444(16bit)
-        int crop[4] = { 0 };
-        m_convert_yc48_to_yuv444_16->run(false,
-            frameHostIn->ptr().data(), (const void **)&pInputFrame->ptr[0],
-            pInputFrame->width, pInputFrame->pitch[0], pInputFrame->pitch[0],
-            frameHostIn->pitch(RGY_PLANE_Y), pInputFrame->height, frameHostIn->height(), crop);
-    }
-
-    if ((err = frameDevIn->unmapBuffer()) != RGY_ERR_NONE) {
-        PrintMes(RGY_LOG_ERROR, _T("failed to unmap input buffer: %s.\n"), get_err_mes(err));
-        return err;
-    }
-    return RGY_ERR_NONE;
-}
-
-RGY_ERR clFilterChain::getOutFrame(RGYFrameInfo *pOutputFrame) {
-    if (!m_cl) {
-        return RGY_ERR_NULL_PTR;
-    }
-    auto frameDevOut = dynamic_cast<RGYCLFrame*>(m_frameOut->get_out(pOutputFrame->inputFrameId));
-    if (!frameDevOut) {
-        return RGY_ERR_NULL_PTR;
-    }
-    m_frameOut->out_to_next();
-
-    if (!frameDevOut) {
-        return RGY_ERR_OUT_OF_RANGE;
-    }
-    frameDevOut->mapWait();
-    copyFramePropWithoutCsp(pOutputFrame, &frameDevOut->frame);
-    {
-        auto frameHostOut = frameDevOut->mappedHost();
-        //YUV444(16bit)->YC48
-        int crop[4] = { 0 };
-        m_convert_yuv444_16_to_yc48->run(false,
-            (void **)&pOutputFrame->ptr[0], (const void **)frameHostOut->ptr().data(),
-            frameHostOut->width(), frameHostOut->pitch(RGY_PLANE_Y), frameHostOut->pitch(RGY_PLANE_Y),
-            pOutputFrame->pitch[0], frameHostOut->height(), pOutputFrame->height, crop);
-    }
-    auto err = frameDevOut->unmapBuffer();
-    if (err != RGY_ERR_NONE) {
-        PrintMes(RGY_LOG_ERROR, _T("failed to unmap output buffer: %s.\n"), get_err_mes(err));
-        return err;
-    }
-    frameDevOut->resetMappedFrame();
-    return RGY_ERR_NONE;
-}
-
-RGY_ERR clFilterChain::proc(const int frameID, const clFilterChainParam& prm) {
-    if (!m_cl) {
-        return RGY_ERR_NULL_PTR;
-    }
-    auto frameDevIn = dynamic_cast<RGYCLFrame*>(m_frameIn->get_out(frameID));
-    m_frameIn->out_to_next();
-
-    if (!frameDevIn) {
-        return RGY_ERR_OUT_OF_RANGE;
-    }
-    m_cl->setModuleHandle(prm.hModule);
-    m_log->setLogLevelAll(prm.log_level);
-    m_log->setLogFile(prm.log_to_file ? LOG_FILE_NAME : nullptr);
-    m_prm = prm;
-
-    auto frameDevOut = dynamic_cast<RGYCLFrame*>(m_frameOut->get_in(prm.outWidth, prm.outHeight));
-    m_frameOut->in_to_next();
-
-    //フィルタチェーン更新
-    auto err = filterChainCreate(&frameDevIn->frame, prm.outWidth, prm.outHeight);
-    if (err != RGY_ERR_NONE) {
-        PrintMes(RGY_LOG_ERROR, _T("failed to update filter chain.\n"));
-        return err;
-    }
-
-    frameDevIn->mapWait();
-
-    //通常は、最後のひとつ前のフィルタまで実行する
-    //上書き型のフィルタが最後の場合は、そのフィルタまで実行する(最後はコピーが必須)
-    const auto filterfin = (m_filters.back().second->GetFilterParam()->bOutOverwrite) ? m_filters.size() : m_filters.size() - 1;
-    //フィルタチェーン実行
-    auto frameInfo = frameDevIn->frame;
-    for (size_t ifilter = 0; ifilter < filterfin; ifilter++) {
-        int nOutFrames = 0;
-        RGYFrameInfo *outInfo[16] = { 0 };
-        auto clfilter = dynamic_cast<RGYFilter*>(m_filters[ifilter].second.get());
-        err = clfilter->filter(&frameInfo, (RGYFrameInfo **)&outInfo, &nOutFrames);
-        if (err != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("Error while running filter \"%s\": %s.\n"), m_filters[ifilter].second->name().c_str(), get_err_mes(err));
-            return err;
-        }
-        if (nOutFrames > 1) {
-            PrintMes(RGY_LOG_ERROR, _T("Currently only simple filters are supported.\n"));
-            return RGY_ERR_UNSUPPORTED;
-        }
-        frameInfo = *(outInfo[0]);
-    }
-    //最後のフィルタ
-    if (m_filters.back().second->GetFilterParam()->bOutOverwrite) {
-        if ((err = m_cl->copyFrame(&frameDevOut->frame, &frameInfo)) != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("Error in frame copy: %s.\n"), get_err_mes(err));
-            return err;
-        }
-    } else {
-        auto& lastFilter = m_filters[m_filters.size() - 1];
-        int nOutFrames = 0;
-        RGYFrameInfo *outInfo[16] = { 0 };
-        outInfo[0] = &frameDevOut->frame;
-        auto clfilter = dynamic_cast<RGYFilter*>(lastFilter.second.get());
-        err = clfilter->filter(&frameInfo, (RGYFrameInfo **)&outInfo, &nOutFrames);
-        if (err != RGY_ERR_NONE) {
-            PrintMes(RGY_LOG_ERROR, _T("Error while running filter \"%s\": %s.\n"), lastFilter.second->name().c_str(), get_err_mes(err));
-            return err;
-        }
-    }
-    if ((err = frameDevOut->queueMapBuffer(m_cl->queue(), CL_MAP_READ)) != RGY_ERR_NONE) {
-        PrintMes(RGY_LOG_ERROR, _T("failed to queue map input buffer: %s.\n"), get_err_mes(err));
-        return err;
-    }
-    return RGY_ERR_NONE;
-}
+﻿// -----------------------------------------------------------------------------------------
+// clfilters by rigaya
+// -----------------------------------------------------------------------------------------
+//
+// The MIT License
+//
+// Copyright (c) 2022-2024 rigaya
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// ------------------------------------------------------------------------------------------
+
+#include <cmath>
+#include "clcufilters_version.h"
+#include "clfilters_chain.h"
+#include "clcufilters_chain_prm.h"
+#include "rgy_cmd.h"
+#include "rgy_filter_colorspace.h"
+#include "rgy_filter_nnedi.h"
+#include "rgy_filter_denoise_knn.h"
+#include "rgy_filter_denoise_nlmeans.h"
+#include "rgy_filter_denoise_pmd.h"
+#include "rgy_filter_denoise_dct.h"
+#include "rgy_filter_libplacebo.h"
+#include "rgy_filter_smooth.h"
+#include "rgy_filter_unsharp.h"
+#include "rgy_filter_resize.h"
+#include "rgy_filter_edgelevel.h"
+#include "rgy_filter_warpsharp.h"
+#include "rgy_filter_deband.h"
+#include "rgy_filter_tweak.h"
+#include "rgy_device.h"
+#include "rgy_filesystem.h"
+
+static const TCHAR *WORKSIZE_TUNE_FILE_NAME = _T("clfilters.worksize.txt");
+
+//ローカルワークサイズの自動調整結果の保存先
+//exeのフォルダは書き込めるとは限らないので、ユーザーごとのフォルダ(%LOCALAPPDATA%\clfilters)に保存する
+static tstring workSizeTuneFilePath() {
+    TCHAR appData[MAX_PATH] = { 0 };
+    if (GetEnvironmentVariable(_T("LOCALAPPDATA"), appData, _countof(appData)) == 0) {
+        return tstring();
+    }
+    const auto dir = PathCombineS(tstring(appData), tstring(_T("clfilters")));
+    if (!rgy_directory_exists(dir) && !CreateDirectoryRecursive(dir.c_str())) {
+        return tstring();
+    }
+    return PathCombineS(dir, tstring(WORKSIZE_TUNE_FILE_NAME));
+}
+
+static tstring luidToString(const void *uuid) {
+    tstring str;
+    const uint8_t *buf = (const uint8_t *)uuid;
+    for (size_t i = 0; i < CL_LUID_SIZE_KHR; ++i) {
+        char tmp[4];
+        _stprintf_s(tmp, "%02x", buf[i]);
+        str += tmp;
+    }
+    return str;
+};
+
+clFilterFrameBuffer::clFilterFrameBuffer(std::shared_ptr<RGYOpenCLContext> cl, const bool staging) :
+    clcuFilterFrameBuffer(),
+    m_cl(cl),
+    m_staging(staging) {
+
+}
+
+clFilterFrameBuffer::~clFilterFrameBuffer() {
+    freeFrames();
+}
+
+std::unique_ptr<RGYFrame> clFilterFrameBuffer::allocateFrame(const int width, const int height) {
+    if (m_staging) {
+        auto frameDev = m_cl->createFrameBuffer(width, height, RGY_CSP_YUV444_16, 16, CL_MEM_READ_WRITE);
+        auto frameStaging = m_cl->createFrameBuffer(width, height, RGY_CSP_YUV444_16, 16, CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR);
+        //ステージングバッファは確保時に一度だけmapし、以降はmapしたまま使用する
+        if (frameDev && frameStaging
+            && frameStaging->queueMapBuffer(m_cl->queue(), CL_MAP_READ | CL_MAP_WRITE, {}, RGY_CL_MAP_BLOCK_ALL) == RGY_ERR_NONE) {
+            auto frame = std::make_unique<clFilterStagedFrame>(frameDev->frame, frameDev->clflags, frameDev->m_arena, std::move(frameStaging));
+            //デバイスメモリの解放はclFilterStagedFrameで行う
+            for (auto& ptr : frameDev->frame.ptr) {
+                ptr = nullptr;
+            }
+            return frame;
+        }
+    }
+    return m_cl->createFrameBuffer(width, height, RGY_CSP_YUV444_16, 16, CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR);
+}
+
+void clFilterFrameBuffer::resetMappedFrame(RGYFrame *frame) {
+    if (auto clFrame = dynamic_cast<RGYCLFrame *>(frame); clFrame) {
+        clFrame->resetMappedFrame();
+    }
+}
+
+clFilterChain::clFilterChain() :
+    clcuFilterChain(),
+    m_cl(),
+    m_dx11(),
+    m_platformID(-1),
+    m_colorspaceLUTBake(0),
+    m_launchReplay(false),
+    m_frameArena(true),
+    m_transferStaging(true),
+    m_chainFp16(CLCU_CHAIN_FP16_OFF),
+    m_clfp16support(false),
+    m_chainFp16Suspend(false),
+    m_chainFp16ReportPrm(),
+    m_frameArenaUsed(0),
+    m_replay(),
+    m_queueSendIn(),
+    m_queueGetOut(),
+    m_eventInSent(),
+    m_eventInProcFin(),
+    m_eventProcFin(),
+    m_eventGetOut() {
+
+}
+
+clFilterChain::~clFilterChain() {
+    close();
+}
+
+void clFilterChain::close() {
+    m_replay.reset(); // m_filters.clear() の前 (記録したカーネルを参照している)
+    m_filters.clear();
+    m_frameIn.reset();
+    m_queueSendIn.finish(); // m_frameIn.reset() のあと
+    m_queueSendIn.clear();  // m_frameIn.reset() のあと
+    m_frameOut.reset();
+    m_queueGetOut.finish(); // m_frameOut.reset() のあと
+    m_queueGetOut.clear();  // m_frameOut.reset() のあと
+    m_eventInSent.clear();
+    m_eventInProcFin.clear();
+    m_eventProcFin.reset();
+    m_eventGetOut.reset();
+    m_cl.reset();
+    m_deviceName.clear();
+    m_convert_yc48_to_yuv444_16.reset();
+    m_convert_yuv444_16_to_yc48.reset();
+    m_log.reset();
+    m_platformID = -1;
+    m_deviceID = -1;
+}
+
+RGY_ERR clFilterChain::initDevice(const clcuFilterDeviceParam *param) {
+    auto prm = dynamic_cast<const clFilterDeviceParam *>(param);
+    const int platformID = prm->platformID;
+    const int deviceID = prm->deviceID;
+    const cl_device_type device_type = prm->deviceType;
+    m_colorspaceLUTBake = prm->colorspaceLUTBake;
+    m_launchReplay = prm->launchReplay;
+    m_frameArena = prm->frameArena;
+    m_transferStaging = prm->transferStaging;
+    m_chainFp16 = prm->chainFp16;
+    PrintMes(RGY_LOG_INFO, _T("start init OpenCL platform %d, device %d\n"), platformID, deviceID);
+
+    RGYOpenCL cl(m_log);
+    auto platforms = cl.getPlatforms(nullptr);
+    if (platforms.size() == 0) {
+        PrintMes(RGY_LOG_ERROR, _T("No OpenCL Platform found on this system.\n"));
+        return RGY_ERR_DEVICE_NOT_FOUND;
+    }
+    if (prm->noNVCL) {
+        PrintMes(RGY_LOG_DEBUG, _T("noNVCL = true.\n"));
+        for (auto it = platforms.begin(); it != platforms.end();) {
+            if ((*it)->isVendor("NVIDIA")) {
+                it = platforms.erase(it);
+            } else {
+                it++;
+            }
+        }
+    }
+
+    if (platformID >= 0 && platformID >= (int)platforms.size()) {
+        PrintMes(RGY_LOG_ERROR, _T("platform %d does not exist (platform count = %d)\n"), platformID, (int)platforms.size());
+        return RGY_ERR_DEVICE_NOT_FOUND;
+    }
+    PrintMes(RGY_LOG_INFO, _T("OpenCL platform count %d\n"), (int)platforms.size());
+
+    auto& platform = platforms[std::max(platformID, 0)];
+
+    auto err = err_cl_to_rgy(platform->createDeviceList(device_type));
+    if (err != RGY_ERR_NONE) {
+        PrintMes(RGY_LOG_ERROR, _T("Failed to create device list: %s\n"), get_err_mes(err));
+        return RGY_ERR_DEVICE_NOT_FOUND;
+    }
+    PrintMes(RGY_LOG_INFO, _T("created device list: %d device(s).\n"), platform->devs().size());
+
+    if (deviceID >= 0 && deviceID >= (int)platform->devs().size()) {
+        PrintMes(RGY_LOG_ERROR, _T("Invalid device Id %d (device count %d)\n"), deviceID, (int)platform->devs().size());
+        return RGY_ERR_INVALID_DEVICE;
+    }
+
+    uint8_t devLUID[CL_LUID_SIZE_KHR];
+    memcpy(devLUID, platform->dev(std::max(deviceID, 0)).info().luid, sizeof(devLUID));
+    PrintMes(RGY_LOG_INFO, _T("created OpenCL context, selcted device %d, LUID=%s.\n"), deviceID, luidToString(devLUID).c_str());
+
+    const int dx11AdaptorCount = DeviceDX11::adapterCount();
+    for (int iadaptor = 0; iadaptor < dx11AdaptorCount; iadaptor++) {
+        auto dx11 = std::make_unique<DeviceDX11>();
+        err = dx11->Init(iadaptor, m_log);
+        if (err != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_DEBUG, _T("Failed to init DX11 device #%d: %s\n"), iadaptor, get_err_mes(err));
+            return err;
+        }
+        const auto dx11UUID = dx11->getLUID();
+        PrintMes(RGY_LOG_DEBUG, _T("Initialized DX11 device %d, LUID=%s.\n"), deviceID, luidToString(&dx11UUID).c_str());
+
+        if (memcmp(&dx11UUID, devLUID, sizeof(dx11UUID)) == 0) {
+            m_dx11 = std::move(dx11);
+            PrintMes(RGY_LOG_INFO, _T("Selected DX11 device %d.\n"), deviceID, luidToString(devLUID).c_str());
+            break;
+        }
+    }
+    if (m_dx11) {
+        if (platform->createDeviceListD3D11(CL_DEVICE_TYPE_GPU, m_dx11->GetDevice()) != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_WARN, _T("Failed to create OpenCL device list from DX11 device.\n"));
+            m_dx11.reset();
+        }
+    }
+    if (!m_dx11) {
+        platform->setDev(platform->devs()[std::max(deviceID, 0)], nullptr, m_dx11->GetDevice());
+    }
+    m_cl = std::make_shared<RGYOpenCLContext>(platform, m_log);
+    if (m_cl->createContext(0) != RGY_ERR_NONE) {
+        PrintMes(RGY_LOG_ERROR, _T("Failed to create OpenCL context.\n"));
+        return RGY_ERR_UNKNOWN;
+    }
+    const auto& devInfo = platform->dev(0).info();
+
+    m_deviceName = (devInfo.board_name_amd.length() > 0) ? devInfo.board_name_amd : devInfo.name;
+    m_platformID = platformID;
+    m_deviceID = deviceID;
+    m_queueSendIn = m_cl->createQueue(platform->dev(0).id(), 0 /*CL_QUEUE_PROFILING_ENABLE*/);
+    m_queueGetOut = m_cl->createQueue(platform->dev(0).id(), 0 /*CL_QUEUE_PROFILING_ENABLE*/);
+    m_clfp16support = platform->dev(0).checkExtension("cl_khr_fp16");
+    if (m_chainFp16 != CLCU_CHAIN_FP16_OFF) {
+        PrintMes((m_clfp16support) ? RGY_LOG_DEBUG : RGY_LOG_WARN, _T("chain fp16: %s.\n"), (m_clfp16support) ? _T("enabled") : _T("fp16 not supported on this device"));
+    }
+    if (m_chainFp16 == CLCU_CHAIN_FP16_REPORT && m_clfp16support) {
+        //比較のため同じフレームをもう一度処理するので、時間方向のフィルタでは次のフレームの出力が変わる
+        PrintMes(RGY_LOG_WARN, _T("chain fp16 report: each report processes the frame twice, so temporal filters may produce a different output for the next frame.\n"));
+    }
+
+    //ローカルワークサイズの自動調整結果を読み込み、以降にビルドするカーネルで使用する
+    //計測中はカーネルの起動ごとに完了を待つため、指定された場合のみ有効にする
+    if (prm->workSizeTune) {
+        auto tuner = std::make_shared<RGYOpenCLWorkSizeTuner>(m_log);
+        tuner->load(workSizeTuneFilePath());
+        m_cl->setWorkSizeTuner(tuner);
+        PrintMes(RGY_LOG_DEBUG, _T("work size tuning enabled.\n"));
+    }
+
+    //フィルタ内部のフレームは、サイズクラスごとにまとめて確保したメモリから切り出す
+    if (m_frameArena) {
+        m_cl->setFrameArena(std::make_shared<RGYCLFrameArena>(m_cl->context(), devInfo, m_log));
+        m_frameArenaUsed = 0;
+    }
+
+    m_frameIn = std::make_unique<clFilterFrameBuffer>(m_cl, m_transferStaging);
+    m_frameOut = std::make_unique<clFilterFrameBuffer>(m_cl, m_transferStaging);
+
+    PrintMes(RGY_LOG_INFO, _T("created OpenCL context, selcted device %s.\n"), m_deviceName.c_str());
+    return RGY_ERR_NONE;
+}
+
+//フィルタが入力フレームを上書きしながら処理できるか
+static bool inplaceSupported(const std::unique_ptr<RGYFilterBase>& filter, const RGYFilterParam *param) {
+    auto clfilter = dynamic_cast<const RGYFilter*>(filter.get());
+    return clfilter && clfilter->inplaceSupported(param);
+}
+
+RGY_ERR clFilterChain::configureOneFilter(std::unique_ptr<RGYFilterBase>& filter, RGYFrameInfo& inputFrame, const VppType filterType, const int resizeWidth, const int resizeHeight) {
+    // colorspace
+    if (filterType == VppType::CL_COLORSPACE) {
+        if (!filter) {
+            //フィルタチェーンに追加
+            filter.reset(new RGYFilterColorspace(m_cl));
+        }
+        std::shared_ptr<RGYFilterParamColorspace> param(new RGYFilterParamColorspace());
+        param->colorspace = m_prmFilter.vpp.colorspace;
+        param->lutBakeSize = m_colorspaceLUTBake;
+        param->frameIn = inputFrame;
+        param->frameOut = inputFrame;
+        param->bOutOverwrite = inplaceSupported(filter, param.get());
+        auto sts = filter->init(param, m_log);
+        if (sts != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to init colorspace.\n"));
+            return sts;
+        }
+        //入力フレーム情報を更新
+        inputFrame = param->frameOut;
+    }
+    // libplacebo-tonemap
+    if (filterType == VppType::CL_LIBPLACEBO_TONEMAP) {
+        if (!filter) {
+            //フィルタチェーンに追加
+            filter.reset(new RGYFilterLibplaceboToneMapping(m_cl));
+        }
+        std::shared_ptr<RGYFilterParamLibplaceboToneMapping> param(new RGYFilterParamLibplaceboToneMapping());
+        param->toneMapping = m_prmFilter.vpp.libplacebo_tonemapping;
+        param->frameIn = inputFrame;
+        param->frameOut = inputFrame;
+        param->bOutOverwrite = inplaceSupported(filter, param.get());
+        auto sts = filter->init(param, m_log);
+        if (sts != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to init libplacebo-tonemap.\n"));
+            return sts;
+        }
+        //入力フレーム情報を更新
+        inputFrame = param->frameOut;
+    }
+    // nnedi
+    if (filterType == VppType::CL_NNEDI) {
+        if (!filter) {
+            //フィルタチェーンに追加
+            filter.reset(new RGYFilterNnedi(m_cl));
+        }
+        std::shared_ptr<RGYFilterParamNnedi> param(new RGYFilterParamNnedi());
+        param->nnedi = m_prmFilter.vpp.nnedi;
+        param->hModule = nullptr;
+        param->frameIn = inputFrame;
+        param->frameOut = inputFrame;
+        param->timebase = rgy_rational<int>(); // bobで使用するが、clfiltersではbobはサポートしない
+        param->bOutOverwrite = inplaceSupported(filter, param.get());
+        auto sts = filter->init(param, m_log);
+        if (sts != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to init nnedi.\n"));
+            return sts;
+        }
+        //入力フレーム情報を更新
+        inputFrame = param->frameOut;
+    }
+    //ノイズ除去 (knn)
+    if (filterType == VppType::CL_DENOISE_KNN) {
+        if (!filter) {
+            //フィルタチェーンに追加
+            filter.reset(new RGYFilterDenoiseKnn(m_cl));
+        }
+        std::shared_ptr<RGYFilterParamDenoiseKnn> param(new RGYFilterParamDenoiseKnn());
+        param->knn = m_prmFilter.vpp.knn;
+        param->frameIn = inputFrame;
+        param->frameOut = inputFrame;
+        param->bOutOverwrite = inplaceSupported(filter, param.get());
+        auto sts = filter->init(param, m_log);
+        if (sts != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to init knn.\n"));
+            return sts;
+        }
+        //入力フレーム情報を更新
+        inputFrame = param->frameOut;
+    }
+    //ノイズ除去 (nlmeans)
+    if (filterType == VppType::CL_DENOISE_NLMEANS) {
+        if (!filter) {
+            //フィルタチェーンに追加
+            filter.reset(new RGYFilterDenoiseNLMeans(m_cl));
+        }
+        std::shared_ptr<RGYFilterParamDenoiseNLMeans> param(new RGYFilterParamDenoiseNLMeans());
+        param->nlmeans = m_prmFilter.vpp.nlmeans;
+        param->frameIn = inputFrame;
+        param->frameOut = inputFrame;
+        param->bOutOverwrite = inplaceSupported(filter, param.get());
+        auto sts = filter->init(param, m_log);
+        if (sts != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to init nlmeans.\n"));
+            return sts;
+        }
+        //入力フレーム情報を更新
+        inputFrame = param->frameOut;
+    }
+    //ノイズ除去 (pmd)
+    if (filterType == VppType::CL_DENOISE_PMD) {
+        if (!filter) {
+            //フィルタチェーンに追加
+            filter.reset(new RGYFilterDenoisePmd(m_cl));
+        }
+        std::shared_ptr<RGYFilterParamDenoisePmd> param(new RGYFilterParamDenoisePmd());
+        param->pmd = m_prmFilter.vpp.pmd;
+        param->frameIn = inputFrame;
+        param->frameOut = inputFrame;
+        param->bOutOverwrite = inplaceSupported(filter, param.get());
+        auto sts = filter->init(param, m_log);
+        if (sts != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to init pmd.\n"));
+            return sts;
+        }
+        //入力フレーム情報を更新
+        inputFrame = param->frameOut;
+    }
+    //ノイズ除去 (smooth)
+    if (filterType == VppType::CL_DENOISE_DCT) {
+        if (!filter) {
+            //フィルタチェーンに追加
+            filter.reset(new RGYFilterDenoiseDct(m_cl));
+        }
+        std::shared_ptr<RGYFilterParamDenoiseDct> param(new RGYFilterParamDenoiseDct());
+        param->dct = m_prmFilter.vpp.dct;
+        param->frameIn = inputFrame;
+        param->frameOut = inputFrame;
+        param->bOutOverwrite = inplaceSupported(filter, param.get());
+        auto sts = filter->init(param, m_log);
+        if (sts != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to init smooth.\n"));
+            return sts;
+        }
+        //入力フレーム情報を更新
+        inputFrame = param->frameOut;
+    }
+    //ノイズ除去 (smooth)
+    if (filterType == VppType::CL_DENOISE_SMOOTH) {
+        if (!filter) {
+            //フィルタチェーンに追加
+            filter.reset(new RGYFilterSmooth(m_cl));
+        }
+        std::shared_ptr<RGYFilterParamSmooth> param(new RGYFilterParamSmooth());
+        param->smooth = m_prmFilter.vpp.smooth;
+        param->frameIn = inputFrame;
+        param->frameOut = inputFrame;
+        param->bOutOverwrite = inplaceSupported(filter, param.get());
+        auto sts = filter->init(param, m_log);
+        if (sts != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to init smooth.\n"));
+            return sts;
+        }
+        //入力フレーム情報を更新
+        inputFrame = param->frameOut;
+    }
+
+    //リサイズ
+    if (filterType == VppType::CL_RESIZE) {
+        if (!filter) {
+            //フィルタチェーンに追加
+            filter.reset(new RGYFilterResize(m_cl));
+        }
+        std::shared_ptr<RGYFilterParamResize> param(new RGYFilterParamResize());
+        param->interp = m_prmFilter.vpp.resize_algo;
+        param->frameIn = inputFrame;
+        param->frameOut = inputFrame;
+        param->frameOut.width = resizeWidth;
+        param->frameOut.height = resizeHeight;
+        if (isLibplaceboResizeFiter(m_prmFilter.vpp.resize_algo)) {
+            param->libplaceboResample = std::make_shared<RGYFilterParamLibplaceboResample>();
+            param->libplaceboResample->resample = m_prmFilter.vpp.resize_libplacebo;
+            //param->libplaceboResample->vui = VuiFiltered;
+            //param->libplaceboResample->dx11 = m_dx11.get();
+            //param->libplaceboResample->vk = m_dev->vulkan();
+            param->libplaceboResample->resize_algo = m_prmFilter.vpp.resize_algo;
+        }
+        param->bOutOverwrite = inplaceSupported(filter, param.get());
+        auto sts = filter->init(param, m_log);
+        if (sts != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to init resize.\n"));
+            return sts;
+        }
+        //入力フレーム情報を更新
+        inputFrame = param->frameOut;
+    }
+    //unsharp
+    if (filterType == VppType::CL_UNSHARP) {
+        if (!filter) {
+            //フィルタチェーンに追加
+            filter.reset(new RGYFilterUnsharp(m_cl));
+        }
+        std::shared_ptr<RGYFilterParamUnsharp> param(new RGYFilterParamUnsharp());
+        param->unsharp = m_prmFilter.vpp.unsharp;
+        param->frameIn = inputFrame;
+        param->frameOut = inputFrame;
+        param->bOutOverwrite = inplaceSupported(filter, param.get());
+        auto sts = filter->init(param, m_log);
+        if (sts != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to init unsharp.\n"));
+            return sts;
+        }
+        //入力フレーム情報を更新
+        inputFrame = param->frameOut;
+    }
+    //edgelevel
+    if (filterType == VppType::CL_EDGELEVEL) {
+        if (!filter) {
+            //フィルタチェーンに追加
+            filter.reset(new RGYFilterEdgelevel(m_cl));
+        }
+        std::shared_ptr<RGYFilterParamEdgelevel> param(new RGYFilterParamEdgelevel());
+        param->edgelevel = m_prmFilter.vpp.edgelevel;
+        param->frameIn = inputFrame;
+        param->frameOut = inputFrame;
+        param->bOutOverwrite = inplaceSupported(filter, param.get());
+        auto sts = filter->init(param, m_log);
+        if (sts != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to init edgelevel.\n"));
+            return sts;
+        }
+        //入力フレーム情報を更新
+        inputFrame = param->frameOut;
+    }
+    //warpsharp
+    if (filterType == VppType::CL_WARPSHARP) {
+        if (!filter) {
+            //フィルタチェーンに追加
+            filter.reset(new RGYFilterWarpsharp(m_cl));
+        }
+        std::shared_ptr<RGYFilterParamWarpsharp> param(new RGYFilterParamWarpsharp());
+        param->warpsharp = m_prmFilter.vpp.warpsharp;
+        param->frameIn = inputFrame;
+        param->frameOut = inputFrame;
+        param->bOutOverwrite = inplaceSupported(filter, param.get());
+        auto sts = filter->init(param, m_log);
+        if (sts != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to init warpsharp.\n"));
+            return sts;
+        }
+        //入力フレーム情報を更新
+        inputFrame = param->frameOut;
+    }
+    //tweak
+    if (filterType == VppType::CL_TWEAK) {
+        if (!filter) {
+            //フィルタチェーンに追加
+            filter.reset(new RGYFilterTweak(m_cl));
+        }
+        std::shared_ptr<RGYFilterParamTweak> param(new RGYFilterParamTweak());
+        param->tweak = m_prmFilter.vpp.tweak;
+        param->frameIn = inputFrame;
+        param->frameOut = inputFrame;
+        param->bOutOverwrite = inplaceSupported(filter, param.get());
+        auto sts = filter->init(param, m_log);
+        if (sts != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to init tweak.\n"));
+            return sts;
+        }
+        //入力フレーム情報を更新
+        inputFrame = param->frameOut;
+    }
+    //deband
+    if (filterType == VppType::CL_DEBAND) {
+        if (!filter) {
+            //フィルタチェーンに追加
+            filter.reset(new RGYFilterDeband(m_cl));
+        }
+        std::shared_ptr<RGYFilterParamDeband> param(new RGYFilterParamDeband());
+        param->deband = m_prmFilter.vpp.deband;
+        param->frameIn = inputFrame;
+        param->frameOut = inputFrame;
+        param->bOutOverwrite = inplaceSupported(filter, param.get());
+        auto sts = filter->init(param, m_log);
+        if (sts != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to init deband.\n"));
+            return sts;
+        }
+        //入力フレーム情報を更新
+        inputFrame = param->frameOut;
+    }
+    //libplacebo-deband
+    if (filterType == VppType::CL_LIBPLACEBO_DEBAND) {
+        if (!filter) {
+            //フィルタチェーンに追加
+            filter.reset(new RGYFilterLibplaceboDeband(m_cl));
+        }
+        std::shared_ptr<RGYFilterParamLibplaceboDeband> param(new RGYFilterParamLibplaceboDeband());
+        param->deband = m_prmFilter.vpp.libplacebo_deband;
+        param->frameIn = inputFrame;
+        param->frameOut = inputFrame;
+        param->bOutOverwrite = inplaceSupported(filter, param.get());
+        auto sts = filter->init(param, m_log);
+        if (sts != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to init libplacebo-deband.\n"));
+            return sts;
+        }
+        //入力フレーム情報を更新
+        inputFrame = param->frameOut;
+    }
+
+    return RGY_ERR_NONE;
+}
+
+RGY_ERR clFilterChain::sendInFrame(const RGYFrameInfo *pInputFrame) {
+    if (!m_cl) {
+        return RGY_ERR_NULL_PTR;
+    }
+    auto frameDevIn = dynamic_cast<RGYCLFrame*>(m_frameIn->get_in(pInputFrame->width, pInputFrame->height));
+    if (!frameDevIn) {
+        return RGY_ERR_NULL_PTR;
+    }
+    m_frameIn->in_to_next();
+
+    //このスロットを参照しているフィルタ処理を上書きしないよう、その完了を待ってからmapする
+    //(チェーン全体のフィルタ処理の完了は待たないので、直前のフレームのフィルタ処理と転送が重なる)
+    std::vector<RGYOpenCLEvent> wait_events;
+    if (auto it = m_eventInProcFin.find(frameDevIn); it != m_eventInProcFin.end()) {
+        wait_events.push_back(it->second);
+        m_eventInProcFin.erase(it);
+    }
+    if (pInputFrame->csp == RGY_CSP_YUV444_16) {
+        //AviUtl側でYUV444(16bit)に変換済みの場合は、CPUでのコピーはせず、共有メモリからそのまま転送する
+        copyFramePropWithoutCsp(&frameDevIn->frame, pInputFrame);
+        RGYOpenCLEvent eventSent;
+        auto err = m_cl->copyFrame(&frameDevIn->frame, pInputFrame, nullptr, m_queueSendIn, wait_events, &eventSent);
+        if (err != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to send input frame: %s.\n"), get_err_mes(err));
+            return err;
+        }
+        m_eventInSent[frameDevIn] = eventSent;
+        //共有メモリは次のフレームですぐに上書きされるので、転送の完了を待つ
+        m_queueSendIn.flush();
+        return eventSent.wait();
+    }
+    if (auto frameStaged = dynamic_cast<clFilterStagedFrame*>(frameDevIn); frameStaged) {
+        //ステージングバッファに変換してから、転送用のqueueでデバイスメモリに転送する
+        //ステージングバッファの前回の転送が終わっていれば、フィルタ処理の完了を待たずに変換できる
+        if (frameStaged->transfer() != nullptr) {
+            frameStaged->transfer.wait();
+        }
+        auto frameHostIn = frameStaged->stagingHost();
+        copyFramePropWithoutCsp(&frameStaged->frame, pInputFrame);
+
+        //YC48->YUV444(16bit)
+        int crop[4] = { 0 };
+        m_convert_yc48_to_yuv444_16->run(false,
+            (void **)frameHostIn.ptr, (const void **)&pInputFrame->ptr[0],
+            pInputFrame->width, pInputFrame->pitch[0], pInputFrame->pitch[0],
+            frameHostIn.pitch[0], pInputFrame->height, frameHostIn.height, crop);
+
+        auto err = m_cl->copyFrame(&frameStaged->frame, &frameHostIn, nullptr, m_queueSendIn, wait_events, &frameStaged->transfer);
+        if (err != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to send input frame: %s.\n"), get_err_mes(err));
+            return err;
+        }
+        //転送の完了はここでは待たず、proc側でフィルタ用のqueueに待機させる
+        m_eventInSent[frameDevIn] = frameStaged->transfer;
+        m_queueSendIn.flush();
+        return RGY_ERR_NONE;
+    }
+    auto err = frameDevIn->queueMapBuffer(m_queueSendIn, CL_MAP_WRITE /*CL_​MAP_​WRITE_​INVALIDATE_​REGION*/, wait_events);
+    if (err != RGY_ERR_NONE) {
+        PrintMes(RGY_LOG_ERROR, _T("failed to queue map input buffer: %s.\n"), get_err_mes(err));
+        return err;
+    }
+    frameDevIn->mapWait();
+    copyFramePropWithoutCsp(&frameDevIn->frame, pInputFrame);
+
+    {
+        auto frameHostIn = frameDevIn->mappedHost();
+
+        //YC48->YUV444(16bit)
+        int crop[4] = { 0 };
+        m_convert_yc48_to_yuv444_16->run(false,
+            frameHostIn->ptr().data(), (const void **)&pInputFrame->ptr[0],
+            pInputFrame->width, pInputFrame->pitch[0], pInputFrame->pitch[0],
+            frameHostIn->pitch(RGY_PLANE_Y), pInputFrame->height, frameHostIn->height(), crop);
+    }
+
+    if ((err = frameDevIn->unmapBuffer()) != RGY_ERR_NONE) {
+        PrintMes(RGY_LOG_ERROR, _T("failed to unmap input buffer: %s.\n"), get_err_mes(err));
+        return err;
+    }
+    //転送の完了はここでは待たず、proc側でフィルタ用のqueueに待機させる
+    RGYOpenCLEvent eventSent;
+    if ((err = m_queueSendIn.getmarker(eventSent)) != RGY_ERR_NONE) {
+        PrintMes(RGY_LOG_ERROR, _T("sendInFrame: failed to get marker: %s.\n"), get_err_mes(err));
+        return err;
+    }
+    m_eventInSent[frameDevIn] = eventSent;
+    m_queueSendIn.flush();
+    return RGY_ERR_NONE;
+}
+
+RGY_ERR clFilterChain::getOutFrame(RGYFrameInfo *pOutputFrame) {
+    if (!m_cl) {
+        return RGY_ERR_NULL_PTR;
+    }
+    auto frameDevOut = dynamic_cast<RGYCLFrame*>(m_frameOut->get_out(pOutputFrame->inputFrameId));
+    if (!frameDevOut) {
+        return RGY_ERR_NULL_PTR;
+    }
+    m_frameOut->out_to_next();
+
+    if (!frameDevOut) {
+        return RGY_ERR_OUT_OF_RANGE;
+    }
+    if (auto frameStaged = dynamic_cast<clFilterStagedFrame*>(frameDevOut); frameStaged) {
+        //ステージングバッファへの転送の完了を待って、そこから変換する (unmapは不要)
+        if (frameStaged->transfer() != nullptr) {
+            frameStaged->transfer.wait();
+        }
+        const auto frameHostOut = frameStaged->stagingHost();
+        copyFramePropWithoutCsp(pOutputFrame, &frameStaged->frame);
+        //YUV444(16bit)->YC48
+        int crop[4] = { 0 };
+        m_convert_yuv444_16_to_yc48->run(false,
+            (void **)&pOutputFrame->ptr[0], (const void **)frameHostOut.ptr,
+            frameHostOut.width, frameHostOut.pitch[0], frameHostOut.pitch[0],
+            pOutputFrame->pitch[0], frameHostOut.height, pOutputFrame->height, crop);
+        //転送はフィルタ処理の完了後に行っているので、次に出力先として使う際はこの転送の完了を待てばよい
+        m_eventGetOut = frameStaged->transfer;
+        return RGY_ERR_NONE;
+    }
+    frameDevOut->mapWait();
+    copyFramePropWithoutCsp(pOutputFrame, &frameDevOut->frame);
+    {
+        auto frameHostOut = frameDevOut->mappedHost();
+        //YUV444(16bit)->YC48
+        int crop[4] = { 0 };
+        m_convert_yuv444_16_to_yc48->run(false,
+            (void **)&pOutputFrame->ptr[0], (const void **)frameHostOut->ptr().data(),
+            frameHostOut->width(), frameHostOut->pitch(RGY_PLANE_Y), frameHostOut->pitch(RGY_PLANE_Y),
+            pOutputFrame->pitch[0], frameHostOut->height(), pOutputFrame->height, crop);
+    }
+    auto err = frameDevOut->unmapBuffer();
+    if (err != RGY_ERR_NONE) {
+        PrintMes(RGY_LOG_ERROR, _T("failed to unmap output buffer: %s.\n"), get_err_mes(err));
+        return err;
+    }
+    //unmapの完了はここでは待たず、次に出力先として使う際にフィルタ用のqueueに待機させる
+    if ((err = m_queueGetOut.getmarker(m_eventGetOut)) != RGY_ERR_NONE) {
+        PrintMes(RGY_LOG_ERROR, _T("getOutFrame: failed to get marker: %s.\n"), get_err_mes(err));
+        return err;
+    }
+    m_queueGetOut.flush();
+    frameDevOut->resetMappedFrame();
+    return RGY_ERR_NONE;
+}
+
+//記録したカーネル起動の入出力フレームを、今回の入出力フレームに差し替えるための対応表
+static std::vector<std::pair<cl_mem, cl_mem>> launchReplayPatch(const RGYFrameInfo *recIn, const RGYFrameInfo *recOut, const RGYFrameInfo *frameIn, const RGYFrameInfo *frameOut) {
+    std::vector<std::pair<cl_mem, cl_mem>> patch;
+    for (int i = 0; i < RGY_CSP_PLANES[recIn->csp]; i++) {
+        patch.push_back(std::make_pair((cl_mem)recIn->ptr[i], (cl_mem)frameIn->ptr[i]));
+    }
+    for (int i = 0; i < RGY_CSP_PLANES[recOut->csp]; i++) {
+        patch.push_back(std::make_pair((cl_mem)recOut->ptr[i], (cl_mem)frameOut->ptr[i]));
+    }
+    return patch;
+}
+
+//記録したカーネル起動を、この入力フレームとパラメータで再実行できるか
+bool clFilterChain::launchReplayable(const RGYFrameInfo *frameIn, const clFilterChainParam& prm) const {
+    return m_replay.list
+        && m_replay.list->replayable()
+        && m_replay.prm == prm
+        && !cmpFrameInfoCspResolution(&m_replay.frameIn, frameIn)
+        && memcmp(m_replay.frameIn.pitch, frameIn->pitch, sizeof(frameIn->pitch)) == 0;
+}
+
+//fp16の演算に対応したフィルタは、fp16で処理するよう設定を上書きする
+void clFilterChain::overrideFilterParam(clFilterChainParam& prm) const {
+    if (m_chainFp16 == CLCU_CHAIN_FP16_OFF || !m_clfp16support || m_chainFp16Suspend) {
+        return;
+    }
+    prm.vpp.nnedi.precision = VPP_FP_PRECISION_FP16;
+    prm.vpp.smooth.prec = VPP_FP_PRECISION_FP16;
+    prm.vpp.nlmeans.fp16 = VppNLMeansFP16Opt::All;
+}
+
+//現在のフィルタチェーンで1フレームを処理する (frameInは上書きされることがある)
+RGY_ERR clFilterChain::runFilterChain(RGYFrameInfo *frameIn, RGYFrameInfo *frameOut) {
+    int lastOutFilter = (int)m_filters.size() - 1;
+    while (lastOutFilter >= 0 && m_filters[lastOutFilter].second->GetFilterParam()->bOutOverwrite) {
+        lastOutFilter--;
+    }
+    auto frameInfo = *frameIn;
+    if (lastOutFilter < 0) {
+        auto err = m_cl->copyFrame(frameOut, &frameInfo);
+        if (err != RGY_ERR_NONE) {
+            return err;
+        }
+        frameInfo = *frameOut;
+    }
+    for (int ifilter = 0; ifilter < (int)m_filters.size(); ifilter++) {
+        int nOutFrames = 0;
+        RGYFrameInfo *outInfo[16] = { 0 };
+        if (ifilter == lastOutFilter) {
+            outInfo[0] = frameOut;
+        }
+        auto clfilter = dynamic_cast<RGYFilter*>(m_filters[ifilter].second.get());
+        auto err = clfilter->filter(&frameInfo, (RGYFrameInfo **)&outInfo, &nOutFrames);
+        if (err != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("Error while running filter \"%s\": %s.\n"), m_filters[ifilter].second->name().c_str(), get_err_mes(err));
+            return err;
+        }
+        if (nOutFrames != 1) {
+            return RGY_ERR_UNSUPPORTED;
+        }
+        frameInfo = *(outInfo[0]);
+    }
+    return RGY_ERR_NONE;
+}
+
+//fp16で処理した出力と、fp16を使わずに処理した出力の差を出力する
+//(比較のためにフィルタを設定しなおして同じフレームをもう一度処理するので、時間方向のフィルタの状態は1フレーム分ずれる)
+RGY_ERR clFilterChain::reportChainFp16(RGYFrameInfo *frameIn, const RGYFrameInfo *frameOutFp16, const clFilterChainParam& prm) {
+    auto frameRef = m_cl->createFrameBuffer(*frameOutFp16);
+    auto hostFp16 = m_cl->createFrameBuffer(*frameOutFp16, CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR);
+    auto hostRef = m_cl->createFrameBuffer(*frameOutFp16, CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR);
+    if (!frameRef || !hostFp16 || !hostRef) {
+        return RGY_ERR_MEMORY_ALLOC;
+    }
+    auto err = m_cl->copyFrame(&hostFp16->frame, frameOutFp16);
+    if (err != RGY_ERR_NONE) {
+        return err;
+    }
+    m_chainFp16Suspend = true;
+    err = filterChainCreate(frameIn, prm.outWidth, prm.outHeight);
+    if (err == RGY_ERR_NONE) {
+        err = runFilterChain(frameIn, &frameRef->frame);
+    }
+    m_chainFp16Suspend = false;
+    auto errRestore = filterChainCreate(frameIn, prm.outWidth, prm.outHeight);
+    if (err != RGY_ERR_NONE || (err = errRestore) != RGY_ERR_NONE) {
+        return err;
+    }
+    if ((err = m_cl->copyFrame(&hostRef->frame, &frameRef->frame)) != RGY_ERR_NONE) {
+        return err;
+    }
+    m_cl->queue().finish();
+    for (auto& host : { hostFp16.get(), hostRef.get() }) {
+        if ((err = host->queueMapBuffer(m_cl->queue(), CL_MAP_READ, {}, RGY_CL_MAP_BLOCK_ALL)) != RGY_ERR_NONE) {
+            return err;
+        }
+    }
+    tstring str;
+    for (int iplane = 0; iplane < RGY_CSP_PLANES[frameOutFp16->csp]; iplane++) {
+        const auto planeFp16 = getPlane(&hostFp16->mappedHost()->host(), (RGY_PLANE)iplane);
+        const auto planeRef = getPlane(&hostRef->mappedHost()->host(), (RGY_PLANE)iplane);
+        double sse = 0.0;
+        int maxDiff = 0;
+        for (int y = 0; y < planeRef.height; y++) {
+            const uint16_t *ptrFp16 = (const uint16_t *)(planeFp16.ptr[0] + (size_t)y * planeFp16.pitch[0]);
+            const uint16_t *ptrRef = (const uint16_t *)(planeRef.ptr[0] + (size_t)y * planeRef.pitch[0]);
+            for (int x = 0; x < planeRef.width; x++) {
+                const int diff = std::abs((int)ptrFp16[x] - (int)ptrRef[x]);
+                sse += (double)diff * diff;
+                maxDiff = std::max(maxDiff, diff);
+            }
+        }
+        const double mse = sse / ((double)planeRef.width * planeRef.height);
+        const double psnr = (mse > 0.0) ? 10.0 * std::log10(65535.0 * 65535.0 / mse) : 999.0;
+        str += strsprintf(_T("%s%s: PSNR %.2f dB, max diff %d"), (iplane) ? _T(", ") : _T(""), (iplane == 0) ? _T("Y") : ((iplane == 1) ? _T("U") : _T("V")), psnr, maxDiff);
+    }
+    for (auto& host : { hostFp16.get(), hostRef.get() }) {
+        host->unmapBuffer();
+        host->resetMappedFrame();
+    }
+    PrintMes(RGY_LOG_INFO, _T("chain fp16 vs 16bit integer: %s.\n"), str.c_str());
+    return RGY_ERR_NONE;
+}
+
+RGY_ERR clFilterChain::proc(const int frameID, const clFilterChainParam& prm) {
+    if (!m_cl) {
+        return RGY_ERR_NULL_PTR;
+    }
+    m_cl->setModuleHandle(prm.hModule);
+    m_log->setLogLevelAll(prm.log_level);
+    m_log->setLogFile(prm.log_to_file ? LOG_FILE_NAME : nullptr);
+    m_prm = prm;
+
+    //入出力フレームがそろっていることを確認してから、リングバッファを進める
+    //(途中でエラーを返す場合に、リングバッファの位置がずれないようにする)
+    auto frameDevIn = dynamic_cast<RGYCLFrame*>(m_frameIn->get_out(frameID));
+    if (!frameDevIn) {
+        return RGY_ERR_OUT_OF_RANGE;
+    }
+    auto frameDevOut = dynamic_cast<RGYCLFrame*>(m_frameOut->get_in(prm.outWidth, prm.outHeight));
+    if (!frameDevOut) {
+        return RGY_ERR_OUT_OF_RANGE;
+    }
+    m_frameIn->out_to_next();
+    m_frameOut->in_to_next();
+
+    //フィルタチェーン更新
+    auto err = filterChainCreate(&frameDevIn->frame, prm.outWidth, prm.outHeight);
+    if (err != RGY_ERR_NONE) {
+        PrintMes(RGY_LOG_ERROR, _T("failed to update filter chain.\n"));
+        return err;
+    }
+    //フィルタがフレームを確保しなおした場合は、使われなくなったアリーナのブロックを解放する
+    if (auto arena = m_cl->frameArena(); arena && arena->usedBytes() != m_frameArenaUsed) {
+        arena->compact();
+        m_frameArenaUsed = arena->usedBytes();
+        PrintMes(RGY_LOG_DEBUG, _T("frame arena: %s.\n"), arena->status().c_str());
+    }
+
+    //処理する入力フレームの転送と、出力フレームのunmapの完了をフィルタ用のqueueで待機する
+    //(CPU側では待機せず、GPU上で依存関係を解決する)
+    std::vector<RGYOpenCLEvent> wait_events;
+    if (auto it = m_eventInSent.find(frameDevIn); it != m_eventInSent.end()) {
+        wait_events.push_back(it->second);
+    }
+    wait_events.push_back(m_eventGetOut);
+    for (const auto& event : wait_events) {
+        if (event() != nullptr) {
+            if ((err = m_cl->queue().wait(event)) != RGY_ERR_NONE) {
+                PrintMes(RGY_LOG_ERROR, _T("proc: failed to wait event: %s.\n"), get_err_mes(err));
+                return err;
+            }
+        }
+    }
+
+    //出力フレームを確保するフィルタのうち最後のものは、frameDevOutに直接出力させる
+    //それ以降の上書き型のフィルタは、frameDevOut上でそのまま処理する
+    int lastOutFilter = (int)m_filters.size() - 1;
+    while (lastOutFilter >= 0 && m_filters[lastOutFilter].second->GetFilterParam()->bOutOverwrite) {
+        lastOutFilter--;
+    }
+    //fp16での処理結果の差を出力する場合は、フィルタに上書きされる前の入力フレームを残しておく
+    std::unique_ptr<RGYCLFrame> frameChainFp16ReportIn;
+    if (m_chainFp16 == CLCU_CHAIN_FP16_REPORT && m_clfp16support && m_chainFp16ReportPrm != prm) {
+        m_chainFp16ReportPrm = prm;
+        frameChainFp16ReportIn = m_cl->createFrameBuffer(frameDevIn->frame);
+        if (frameChainFp16ReportIn
+            && m_cl->copyFrame(&frameChainFp16ReportIn->frame, &frameDevIn->frame) != RGY_ERR_NONE) {
+            frameChainFp16ReportIn.reset();
+        }
+    }
+    //カーネル起動を記録し、記録が確定していれば再実行する
+    //(すべて上書き型のフィルタの場合は、先にコピーが必要なので対象外)
+    const bool launchReplay = m_launchReplay && lastOutFilter >= 0;
+    bool replayed = false;
+    if (launchReplay && m_replay.verified && launchReplayable(&frameDevIn->frame, prm)) {
+        const auto patch = launchReplayPatch(&m_replay.frameIn, &m_replay.frameOut, &frameDevIn->frame, &frameDevOut->frame);
+        if ((err = m_replay.list->replay(m_cl->queue(), patch)) != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("Error while replaying filter chain: %s.\n"), get_err_mes(err));
+            m_replay.reset();
+            return err;
+        }
+        copyFramePropWithoutRes(&frameDevOut->frame, &frameDevIn->frame);
+        frameDevOut->frame.picstruct = m_replay.frameOut.picstruct;
+        replayed = true;
+    }
+    if (!replayed) {
+        auto frameInfo = frameDevIn->frame;
+        std::unique_ptr<RGYOpenCLLaunchList> recording;
+        if (launchReplay) {
+            recording = std::make_unique<RGYOpenCLLaunchList>(m_log);
+            m_cl->queue().setRecorder(recording.get());
+        }
+        if (lastOutFilter < 0) {
+            //すべて上書き型のフィルタの場合は、先にframeDevOutにコピーしてから処理する
+            if ((err = m_cl->copyFrame(&frameDevOut->frame, &frameInfo)) != RGY_ERR_NONE) {
+                PrintMes(RGY_LOG_ERROR, _T("Error in frame copy: %s.\n"), get_err_mes(err));
+                return err;
+            }
+            frameInfo = frameDevOut->frame;
+        }
+        //フィルタチェーン実行
+        for (int ifilter = 0; ifilter < (int)m_filters.size(); ifilter++) {
+            int nOutFrames = 0;
+            RGYFrameInfo *outInfo[16] = { 0 };
+            if (ifilter == lastOutFilter) {
+                outInfo[0] = &frameDevOut->frame;
+            }
+            auto clfilter = dynamic_cast<RGYFilter*>(m_filters[ifilter].second.get());
+            const size_t launches = (recording) ? recording->size() : 0;
+            err = clfilter->filter(&frameInfo, (RGYFrameInfo **)&outInfo, &nOutFrames);
+            if (err != RGY_ERR_NONE) {
+                m_cl->queue().setRecorder(nullptr);
+                m_replay.reset();
+                PrintMes(RGY_LOG_ERROR, _T("Error while running filter \"%s\": %s.\n"), m_filters[ifilter].second->name().c_str(), get_err_mes(err));
+                return err;
+            }
+            if (nOutFrames > 1) {
+                m_cl->queue().setRecorder(nullptr);
+                m_replay.reset();
+                PrintMes(RGY_LOG_ERROR, _T("Currently only simple filters are supported.\n"));
+                return RGY_ERR_UNSUPPORTED;
+            }
+            if (recording && recording->size() == launches) {
+                //カーネルを起動しないフィルタは、記録できない方法で処理している可能性があるので再実行しない
+                recording->invalidate();
+            }
+            frameInfo = *(outInfo[0]);
+        }
+        if (recording) {
+            m_cl->queue().setRecorder(nullptr);
+            bool verified = false;
+            if (recording->replayable()) {
+                //直前のフレームの記録と、入出力フレーム以外が一致すれば再実行可能とする
+                verified = launchReplayable(&frameDevIn->frame, prm)
+                    && m_replay.list->equals(*recording, launchReplayPatch(&m_replay.frameIn, &m_replay.frameOut, &frameDevIn->frame, &frameDevOut->frame));
+                if (verified) {
+                    PrintMes(RGY_LOG_DEBUG, _T("filter chain launches recorded: %d kernels.\n"), (int)recording->size());
+                }
+            }
+            m_replay.list = std::move(recording);
+            m_replay.verified = verified;
+            m_replay.prm = prm;
+            m_replay.frameIn = frameDevIn->frame;
+            m_replay.frameOut = frameDevOut->frame;
+        }
+    }
+    if (frameChainFp16ReportIn) {
+        if ((err = reportChainFp16(&frameChainFp16ReportIn->frame, &frameDevOut->frame, prm)) != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_WARN, _T("failed to compare chain fp16 output: %s.\n"), get_err_mes(err));
+        }
+        m_replay.reset(); // フィルタを設定しなおしたので、記録したカーネル起動は使えない
+    }
+    //フィルタ処理の完了後、転送用のqueueで出力フレームをmapする
+    if ((err = m_cl->queue().getmarker(m_eventProcFin)) != RGY_ERR_NONE) {
+        PrintMes(RGY_LOG_ERROR, _T("proc: failed to get marker: %s.\n"), get_err_mes(err));
+        return err;
+    }
+    //入力フレームのスロットは、このフィルタ処理の完了後に次の転送で上書きできる
+    m_eventInProcFin[frameDevIn] = m_eventProcFin;
+    m_cl->queue().flush();
+    if (auto frameStaged = dynamic_cast<clFilterStagedFrame*>(frameDevOut); frameStaged) {
+        //ステージングバッファは、前のフレームの取得(getOutFrame)で読み終わっている
+        auto frameHostOut = frameStaged->stagingHost();
+        if ((err = m_cl->copyFrame(&frameHostOut, &frameStaged->frame, nullptr, m_queueGetOut, { m_eventProcFin }, &frameStaged->transfer)) != RGY_ERR_NONE) {
+            PrintMes(RGY_LOG_ERROR, _T("failed to queue read output buffer: %s.\n"), get_err_mes(err));
+            return err;
+        }
+    } else if ((err = frameDevOut->queueMapBuffer(m_queueGetOut, CL_MAP_READ, { m_eventProcFin })) != RGY_ERR_NONE) {
+        PrintMes(RGY_LOG_ERROR, _T("failed to queue map input buffer: %s.\n"), get_err_mes(err));
+        return err;
+    }
+    m_queueGetOut.flush();
+    return RGY_ERR_NONE;
+}
@@ -1,79 +1,142 @@
-﻿// -----------------------------------------------------------------------------------------
-// clfilters by rigaya
-// -----------------------------------------------------------------------------------------
-//
-// The MIT License
-//
-// Copyright (c) 2022 rigaya
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-// ------------------------------------------------------------------------------------------
-
-#ifndef __CLFILTERS_CHAIN_H__
-#define __CLFILTERS_CHAIN_H__
-
-#include "clcufilters_chain.h"
-#include "rgy_filter_cl.h"
-
-class clFilterFrameBuffer : public clcuFilterFrameBuffer {
-public:
-    clFilterFrameBuffer(std::shared_ptr<RGYOpenCLContext> cl);
-    virtual ~clFilterFrameBuffer();
-
-    virtual std::unique_ptr<RGYFrame> allocateFrame(const int width, const int height) override;
-    virtual void resetMappedFrame(RGYFrame *frame) override;
-protected:
-    std::shared_ptr<RGYOpenCLContext> m_cl;
-};
-
-class clFilterDeviceParam : public clcuFilterDeviceParam {
-public:
-    int platformID;
-    cl_device_type deviceType;
-    bool noNVCL;
-
-    clFilterDeviceParam() : platformID(0), deviceType(CL_DEVICE_TYPE_GPU), noNVCL(true) {};
-    virtual ~clFilterDeviceParam() {};
-};
-
-class DeviceDX11;
-
-class clFilterChain : public clcuFilterChain {
-public:
-    clFilterChain();
-    virtual ~clFilterChain();
-
-    virtual RGY_ERR sendInFrame(const RGYFrameInfo *pInputFrame) override;
-    virtual RGY_ERR proc(const int frameID, const clFilterChainParam& prm) override;
-    virtual RGY_ERR getOutFrame(RGYFrameInfo *pOutputFrame) override;
-
-    virtual int platformID() const override { return m_platformID; }
-protected:
-    virtual RGY_ERR initDevice(const clcuFilterDeviceParam *param) override;
-    virtual void close() override;
-    virtual RGY_ERR configureOneFilter(std::unique_ptr<RGYFilterBase>& filter, RGYFrameInfo& inputFrame, const VppType filterType, const int resizeWidth, const int resizeHeight) override;
-
-    std::shared_ptr<RGYOpenCLContext> m_cl;
-    std::unique_ptr<DeviceDX11> m_dx11;
-    int m_platformID;
-    RGYOpenCLQueue m_queueSendIn;
-};
-
-#endif //__CLFILTERS_CHAIN_H__
+﻿// -----------------------------------------------------------------------------------------
+// clfilters by rigaya
+// -----------------------------------------------------------------------------------------
+//
+// The MIT License
+//
+// Copyright (c) 2022 rigaya
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// ------------------------------------------------------------------------------------------
+
+#ifndef __CLFILTERS_CHAIN_H__
+#define __CLFILTERS_CHAIN_H__
+
+#include <unordered_map>
+#include "clcufilters_chain.h"
+#include "rgy_filter_cl.h"
+
+// ステージングバッファ(常にmapしたままのピン留めされたホストメモリ)を持つ入出力フレーム
+// フレーム自体はデバイスメモリに置き、ステージングバッファとの間は転送用のqueueでコピーする
+struct clFilterStagedFrame : public RGYCLFrame {
+    std::unique_ptr<RGYCLFrame> staging; // ステージングバッファ
+    RGYOpenCLEvent transfer;             // ステージングバッファとの最後の転送の完了
+
+    clFilterStagedFrame(const RGYFrameInfo& info, cl_mem_flags flags, std::shared_ptr<RGYCLFrameArena> arena, std::unique_ptr<RGYCLFrame> staging_)
+        : RGYCLFrame(info, flags, arena), staging(std::move(staging_)), transfer() {};
+    virtual ~clFilterStagedFrame() {
+        if (transfer() != nullptr) {
+            transfer.wait();
+        }
+        staging.reset();
+    }
+    // ステージングバッファのホスト側のフレーム情報
+    RGYFrameInfo stagingHost() const {
+        auto host = staging->mappedHost()->host();
+        host.mem_type = RGY_MEM_TYPE_CPU;
+        return host;
+    }
+};
+
+class clFilterFrameBuffer : public clcuFilterFrameBuffer {
+public:
+    clFilterFrameBuffer(std::shared_ptr<RGYOpenCLContext> cl, const bool staging);
+    virtual ~clFilterFrameBuffer();
+
+    virtual std::unique_ptr<RGYFrame> allocateFrame(const int width, const int height) override;
+    virtual void resetMappedFrame(RGYFrame *frame) override;
+protected:
+    std::shared_ptr<RGYOpenCLContext> m_cl;
+    bool m_staging; // ステージングバッファを使用する (clFilterStagedFrameを確保する)
+};
+
+class clFilterDeviceParam : public clcuFilterDeviceParam {
+public:
+    int platformID;
+    cl_device_type deviceType;
+    bool noNVCL;
+    int colorspaceLUTBake; // colorspaceの変換処理を焼き込む3D LUTのサイズ (0:無効(既定), -1:自動)
+    bool launchReplay;     // フィルタチェーンのカーネル起動を記録し、パラメータが変わらない間は再実行する
+    bool frameArena;       // フィルタ内部のフレームをまとめて確保したデバイスメモリから切り出す
+    bool transferStaging;  // 入出力フレームをデバイスメモリに置き、ステージングバッファ経由で転送する
+    CLCU_CHAIN_FP16 chainFp16; // fp16の演算に対応したフィルタを、チェーン全体でfp16で処理する
+    bool workSizeTune;     // カーネルのローカルワークサイズ等を実際のフレーム処理で計測して選択する
+
+    clFilterDeviceParam() : platformID(0), deviceType(CL_DEVICE_TYPE_GPU), noNVCL(true), colorspaceLUTBake(0), launchReplay(false), frameArena(true), transferStaging(true), chainFp16(CLCU_CHAIN_FP16_OFF), workSizeTune(false) {};
+    virtual ~clFilterDeviceParam() {};
+};
+
+class DeviceDX11;
+
+// フィルタチェーンのカーネル起動の記録
+// 連続する2フレームで同じカーネル起動(入出力フレーム以外の引数が一致)となった場合に、
+// 以降のフレームではフィルタを経由せず、記録したカーネル起動を入出力フレームを差し替えて再実行する
+struct clFilterLaunchReplay {
+    std::unique_ptr<RGYOpenCLLaunchList> list; // 最後に記録したカーネル起動
+    bool verified;          // 直前のフレームの記録と一致したか
+    clFilterChainParam prm; // 記録時のパラメータ
+    RGYFrameInfo frameIn;   // 記録時の入力フレーム
+    RGYFrameInfo frameOut;  // 記録時の出力フレーム
+
+    clFilterLaunchReplay() : list(), verified(false), prm(), frameIn(), frameOut() {};
+    void reset() { list.reset(); verified = false; }
+};
+
+class clFilterChain : public clcuFilterChain {
+public:
+    clFilterChain();
+    virtual ~clFilterChain();
+
+    virtual RGY_ERR sendInFrame(const RGYFrameInfo *pInputFrame) override;
+    virtual RGY_ERR proc(const int frameID, const clFilterChainParam& prm) override;
+    virtual RGY_ERR getOutFrame(RGYFrameInfo *pOutputFrame) override;
+
+    virtual int platformID() const override { return m_platformID; }
+protected:
+    virtual RGY_ERR initDevice(const clcuFilterDeviceParam *param) override;
+    virtual void close() override;
+    virtual RGY_ERR configureOneFilter(std::unique_ptr<RGYFilterBase>& filter, RGYFrameInfo& inputFrame, const VppType filterType, const int resizeWidth, const int resizeHeight) override;
+    bool launchReplayable(const RGYFrameInfo *frameIn, const clFilterChainParam& prm) const;
+    virtual void overrideFilterParam(clFilterChainParam& prm) const override;
+    RGY_ERR runFilterChain(RGYFrameInfo *frameIn, RGYFrameInfo *frameOut);
+    RGY_ERR reportChainFp16(RGYFrameInfo *frameIn, const RGYFrameInfo *frameOutFp16, const clFilterChainParam& prm);
+
+    std::shared_ptr<RGYOpenCLContext> m_cl;
+    std::unique_ptr<DeviceDX11> m_dx11;
+    int m_platformID;
+    int m_colorspaceLUTBake;
+    bool m_launchReplay;
+    bool m_frameArena;
+    bool m_transferStaging;
+    CLCU_CHAIN_FP16 m_chainFp16;
+    bool m_clfp16support;
+    bool m_chainFp16Suspend;      // 比較用に一時的にfp16での処理を無効にする
+    clFilterChainParam m_chainFp16ReportPrm; // 最後に差を出力したときのパラメータ
+    size_t m_frameArenaUsed; // 前回のフレーム処理時点のアリーナの使用量
+    clFilterLaunchReplay m_replay; // フィルタチェーンのカーネル起動の記録
+    RGYOpenCLQueue m_queueSendIn;  // 転送(CPU->GPU)用のqueue
+    RGYOpenCLQueue m_queueGetOut;  // 転送(GPU->CPU)用のqueue
+    std::unordered_map<const RGYFrame *, RGYOpenCLEvent> m_eventInSent;    // 入力フレームのスロットごとの転送完了
+    std::unordered_map<const RGYFrame *, RGYOpenCLEvent> m_eventInProcFin; // 入力フレームのスロットごとの、そのスロットを最後に参照したフィルタ処理の完了
+    RGYOpenCLEvent m_eventProcFin; // 最後に処理したフレームのフィルタ処理完了
+    RGYOpenCLEvent m_eventGetOut;  // 最後に取得した出力フレームのunmap完了
+};
+
+#endif //__CLFILTERS_CHAIN_H__
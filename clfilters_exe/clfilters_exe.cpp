@@ -1,158 +1,279 @@
-﻿// -----------------------------------------------------------------------------------------
-// clfilters by rigaya
-// -----------------------------------------------------------------------------------------
-//
-// The MIT License
-//
-// Copyright (c) 2022 rigaya
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-// ------------------------------------------------------------------------------------------
-
-#include <memory>
-#include <iostream>
-#include "rgy_osdep.h"
-#include "rgy_tchar.h"
-#include "rgy_log.h"
-#include "rgy_event.h"
-#include "rgy_shared_mem.h"
-#include "clcufilters_shared.h"
-#include "clcufilters_chain_prm.h"
-#include "clcufilters_exe_cmd.h"
-#include "clcufilters_version.h"
-#include "clfilters_exe.h"
-#include "clfilters_chain.h"
-#include "rgy_util.h"
-#include "rgy_opencl.h"
-#include "rgy_cmd.h"
-
-
-clFiltersExe::clFiltersExe(bool noNVCL) :
-    clcuFiltersExe(),
-    m_clplatforms(),
-    m_noNVCL(noNVCL) { }
-clFiltersExe::~clFiltersExe() {
-}
-
-RGY_ERR clFiltersExe::initDevices() {
-    if (m_clplatforms.size() == 0) {
-        AddMessage(RGY_LOG_DEBUG, _T("clFiltersExe::initDevices, noNVCL = %s.\n"), m_noNVCL ? _T("true") : _T("false"));
-        auto log = m_log;
-        RGYOpenCL cl(m_log ? m_log : std::make_shared<RGYLog>(nullptr, RGY_LOG_INFO));
-        m_clplatforms = cl.getPlatforms(nullptr);
-        if (m_noNVCL) {
-            for (auto it = m_clplatforms.begin(); it != m_clplatforms.end();) {
-                if ((*it)->isVendor("NVIDIA")) {
-                    it = m_clplatforms.erase(it);
-                } else {
-                    it++;
-                }
-            }
-        }
-        for (auto& platform : m_clplatforms) {
-            platform->createDeviceList(CL_DEVICE_TYPE_GPU);
-        }
-    }
-    return RGY_ERR_NONE;
-}
-
-std::string clFiltersExe::checkDevices() {
-    return checkClPlatforms();
-}
-
-std::string clFiltersExe::checkClPlatforms() {
-    if (m_clplatforms.size() == 0) {
-        initDevices();
-    }
-    std::string devices;
-    for (size_t ip = 0; ip < m_clplatforms.size(); ip++) {
-        for (int idev = 0; idev < (int)m_clplatforms[ip]->devs().size(); idev++) {
-            CL_PLATFORM_DEVICE pd;
-            pd.s.platform = (int16_t)ip;
-            pd.s.device = (int16_t)idev;
-            const auto devInfo = m_clplatforms[ip]->dev(idev).info();
-            auto devName = (devInfo.board_name_amd.length() > 0) ? devInfo.board_name_amd : devInfo.name;
-            devName = str_replace(devName, "(TM)", "");
-            devName = str_replace(devName, "(R)", "");
-            devName = str_replace(devName, "  ", " ");
-            int cudaDummyVer = 0;
-            devices += strsprintf("%x/%d.%d/%s\n", pd.i, cudaDummyVer, cudaDummyVer, devName.c_str());
-            AddMessage(RGY_LOG_DEBUG, _T("Found platform %d, device %d: %s.\n"), pd.s.platform, pd.s.device, char_to_tstring(devName).c_str());
-        }
-    }
-    return devices;
-}
-
-RGY_ERR clFiltersExe::initDevice(const clfitersSharedPrms *sharedPrms, clFilterChainParam& prm) {
-    m_filter = std::make_unique<clFilterChain>();
-    const auto dev_pd = sharedPrms->pd;
-    clFilterDeviceParam dev_param;
-    dev_param.platformID = dev_pd.s.platform;
-    dev_param.deviceID = dev_pd.s.device;
-    dev_param.deviceType = CL_DEVICE_TYPE_GPU;
-    dev_param.noNVCL = m_noNVCL;
-    return m_filter->init(&dev_param, prm.log_level.get(RGY_LOGT_APP), prm.log_to_file, m_log, m_sharedMessage.get());
-}
-
-int _tmain(const int argc, const TCHAR **argv) {
-    AviutlAufExeParams prms;
-    if (parse_cmd(prms, false, argc, argv) != 0) {
-        return 1;
-    }
-    if (prms.clinfo) {
-        const auto str = getOpenCLInfo(CL_DEVICE_TYPE_GPU);
-        _ftprintf(stdout, _T("%s\n"), str.c_str());
-        return 0;
-    }
-    if (prms.checkDevice) {
-        clFiltersExe clfilterexe(prms.noNVCL);
-        const auto str = clfilterexe.checkDevices();
-        _ftprintf(stdout, _T("%s\n"), str.c_str());
-        return 0;
-    }
-    // 構造体サイズの一致を確認
-    if (prms.sizeSharedPrm != sizeof(clfitersSharedPrms)) {
-        _ftprintf(stderr, _T("Invalid size for shared param: %d\n"), prms.sizeSharedPrm);
-        return 1;
-    }
-    if (prms.sizeSharedMesData != sizeof(clfitersSharedMesData)) {
-        _ftprintf(stderr, _T("Invalid size for shared message data: %d\n"), prms.sizeSharedMesData);
-        return 1;
-    }
-    if (prms.sizePIXELYC != SIZE_PIXEL_YC) {
-        _ftprintf(stderr, _T("Invalid size for PIXEL_YC: %d\n"), prms.sizeSharedMesData);
-        return 1;
-    }
-    if (!prms.eventMesStart) {
-        _ftprintf(stderr, _T("Event handle(start) not set.\n"));
-        return 1;
-    }
-    if (!prms.eventMesEnd) {
-        _ftprintf(stderr, _T("Event handle(end) not set.\n"));
-        return 1;
-    }
-    // 実行開始
-    clFiltersExe clfilterexe(prms.noNVCL);
-    clfilterexe.init(prms);
-    int ret = clfilterexe.run();
-    return ret;
-}
-
-
+﻿// -----------------------------------------------------------------------------------------
+// clfilters by rigaya
+// -----------------------------------------------------------------------------------------
+//
+// The MIT License
+//
+// Copyright (c) 2022 rigaya
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// ------------------------------------------------------------------------------------------
+
+#include <memory>
+#include <chrono>
+#include <iostream>
+#include "rgy_osdep.h"
+#include "rgy_tchar.h"
+#include "rgy_log.h"
+#include "rgy_event.h"
+#include "rgy_shared_mem.h"
+#include "clcufilters_shared.h"
+#include "clcufilters_chain_prm.h"
+#include "clcufilters_exe_cmd.h"
+#include "clcufilters_check_csp.h"
+#include "clcufilters_version.h"
+#include "clfilters_exe.h"
+#include "clfilters_chain.h"
+#include "rgy_util.h"
+#include "rgy_opencl.h"
+#include "rgy_cmd.h"
+
+
+clFiltersExe::clFiltersExe(bool noNVCL, int colorspaceLUTBake, bool launchReplay, bool frameArena, bool transferStaging, CLCU_CHAIN_FP16 chainFp16, bool workSizeTune) :
+    clcuFiltersExe(),
+    m_clplatforms(),
+    m_noNVCL(noNVCL),
+    m_colorspaceLUTBake(colorspaceLUTBake),
+    m_launchReplay(launchReplay),
+    m_frameArena(frameArena),
+    m_transferStaging(transferStaging),
+    m_chainFp16(chainFp16),
+    m_workSizeTune(workSizeTune) { }
+clFiltersExe::~clFiltersExe() {
+}
+
+RGY_ERR clFiltersExe::initDevices() {
+    if (m_clplatforms.size() == 0) {
+        AddMessage(RGY_LOG_DEBUG, _T("clFiltersExe::initDevices, noNVCL = %s.\n"), m_noNVCL ? _T("true") : _T("false"));
+        auto log = m_log;
+        RGYOpenCL cl(m_log ? m_log : std::make_shared<RGYLog>(nullptr, RGY_LOG_INFO));
+        m_clplatforms = cl.getPlatforms(nullptr);
+        if (m_noNVCL) {
+            for (auto it = m_clplatforms.begin(); it != m_clplatforms.end();) {
+                if ((*it)->isVendor("NVIDIA")) {
+                    it = m_clplatforms.erase(it);
+                } else {
+                    it++;
+                }
+            }
+        }
+        for (auto& platform : m_clplatforms) {
+            platform->createDeviceList(CL_DEVICE_TYPE_GPU);
+        }
+    }
+    return RGY_ERR_NONE;
+}
+
+std::string clFiltersExe::checkDevices() {
+    return checkClPlatforms();
+}
+
+std::string clFiltersExe::checkClPlatforms() {
+    if (m_clplatforms.size() == 0) {
+        initDevices();
+    }
+    std::string devices;
+    for (size_t ip = 0; ip < m_clplatforms.size(); ip++) {
+        for (int idev = 0; idev < (int)m_clplatforms[ip]->devs().size(); idev++) {
+            CL_PLATFORM_DEVICE pd;
+            pd.s.platform = (int16_t)ip;
+            pd.s.device = (int16_t)idev;
+            const auto devInfo = m_clplatforms[ip]->dev(idev).info();
+            auto devName = (devInfo.board_name_amd.length() > 0) ? devInfo.board_name_amd : devInfo.name;
+            devName = str_replace(devName, "(TM)", "");
+            devName = str_replace(devName, "(R)", "");
+            devName = str_replace(devName, "  ", " ");
+            int cudaDummyVer = 0;
+            devices += strsprintf("%x/%d.%d/%s\n", pd.i, cudaDummyVer, cudaDummyVer, devName.c_str());
+            AddMessage(RGY_LOG_DEBUG, _T("Found platform %d, device %d: %s.\n"), pd.s.platform, pd.s.device, char_to_tstring(devName).c_str());
+        }
+    }
+    return devices;
+}
+
+RGY_ERR clFiltersExe::initDevice(const clfitersSharedPrms *sharedPrms, clFilterChainParam& prm) {
+    m_filter = std::make_unique<clFilterChain>();
+    const auto dev_pd = sharedPrms->pd;
+    clFilterDeviceParam dev_param;
+    dev_param.platformID = dev_pd.s.platform;
+    dev_param.deviceID = dev_pd.s.device;
+    dev_param.deviceType = CL_DEVICE_TYPE_GPU;
+    dev_param.noNVCL = m_noNVCL;
+    dev_param.colorspaceLUTBake = m_colorspaceLUTBake;
+    dev_param.launchReplay = m_launchReplay;
+    dev_param.frameArena = m_frameArena;
+    dev_param.transferStaging = m_transferStaging;
+    dev_param.chainFp16 = m_chainFp16;
+    dev_param.workSizeTune = m_workSizeTune;
+    dev_param.cspThreads = m_cspThreads;
+    dev_param.cspThreadParam = m_cspThreadParam;
+    return m_filter->init(&dev_param, prm.log_level.get(RGY_LOGT_APP), prm.log_to_file, m_log, m_sharedMessage.get());
+}
+
+//カーネル起動のオーバーヘッドの計測用のカーネル
+//処理そのものにかかる時間が無視できるよう、小さなサイズで起動する
+static const char *BENCH_LAUNCH_KERNEL_SRC = R"(
+__kernel void kernel_bench_launch(
+    __global uchar *restrict pDst, const int dstPitch,
+    __global const uchar *restrict pSrc, const int srcPitch,
+    const int width, const int height, const float gain, const int offset) {
+    const int x = get_global_id(0);
+    const int y = get_global_id(1);
+    if (x < width && y < height) {
+        pDst[y * dstPitch + x] = convert_uchar_sat(pSrc[y * srcPitch + x] * gain + offset);
+    }
+}
+)";
+
+//最初に見つかったGPUで、同じ引数でのカーネルの起動を繰り返し、引数のキャッシュの有無での1秒あたりの起動回数を計測する
+static int benchKernelLaunch(tstring& result) {
+    auto log = std::make_shared<RGYLog>(nullptr, RGY_LOG_ERROR);
+    RGYOpenCL cl(log);
+    std::shared_ptr<RGYOpenCLPlatform> platform;
+    for (auto& p : cl.getPlatforms(nullptr)) {
+        if (p->createDeviceList(CL_DEVICE_TYPE_GPU) == RGY_ERR_NONE && p->devs().size() > 0) {
+            platform = p;
+            break;
+        }
+    }
+    if (!platform) {
+        result = _T("bench launch: no OpenCL GPU found.\n");
+        return 1;
+    }
+    platform->setDev(platform->devs()[0]);
+    auto clctx = std::make_shared<RGYOpenCLContext>(platform, log);
+    if (clctx->createContext(0) != RGY_ERR_NONE) {
+        result = _T("bench launch: failed to create OpenCL context.\n");
+        return 1;
+    }
+    const auto devInfo = platform->dev(0).info();
+    auto program = clctx->build(BENCH_LAUNCH_KERNEL_SRC, "");
+    if (!program) {
+        result = _T("bench launch: failed to build kernel.\n");
+        return 1;
+    }
+    const int width = 64, height = 2, pitch = 64;
+    auto bufSrc = clctx->createBuffer(pitch * height);
+    auto bufDst = clctx->createBuffer(pitch * height);
+    if (!bufSrc || !bufDst) {
+        result = _T("bench launch: failed to allocate buffer.\n");
+        return 1;
+    }
+    auto kernel = program->kernel("kernel_bench_launch");
+    if (!kernel.get() || !kernel.get()->get()) {
+        result = _T("bench launch: failed to get kernel.\n");
+        return 1;
+    }
+    auto& queue = clctx->queue();
+    const RGYWorkSize local(32, 2), global(width, height);
+    const int launchCount = 20000;
+    result = strsprintf(_T("bench launch: %s, %d launches, %dx%d\n"), char_to_tstring(devInfo.name).c_str(), launchCount, width, height);
+
+    double launchPerSec[2] = { 0.0, 0.0 };
+    for (int cache = 1; cache >= 0; cache--) {
+        kernel.get()->setArgCacheEnabled(cache != 0);
+        double enqueueMs = 0.0, totalMs = 0.0;
+        //初回はドライバの準備等を含むので、計測から除外する
+        for (int trial = 0; trial < 4; trial++) {
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < launchCount; i++) {
+                auto err = kernel.config(queue, local, global).launch(
+                    (cl_mem)bufDst->mem(), pitch, (cl_mem)bufSrc->mem(), pitch, width, height, 1.0f, 0);
+                if (err != RGY_ERR_NONE) {
+                    result += strsprintf(_T("bench launch: failed to launch kernel: %s.\n"), get_err_mes(err));
+                    return 1;
+                }
+            }
+            const auto enqueued = std::chrono::high_resolution_clock::now();
+            queue.finish();
+            const auto fin = std::chrono::high_resolution_clock::now();
+            if (trial > 0) {
+                const double ms = std::chrono::duration<double, std::milli>(enqueued - start).count();
+                const double msTotal = std::chrono::duration<double, std::milli>(fin - start).count();
+                enqueueMs = (trial == 1) ? ms : std::min(enqueueMs, ms);
+                totalMs = (trial == 1) ? msTotal : std::min(totalMs, msTotal);
+            }
+        }
+        launchPerSec[cache] = launchCount / (enqueueMs * 1e-3);
+        result += strsprintf(_T("  arg cache %-3s: %10.0f launches/s (enqueue %.3f us/launch, incl. finish %.3f us/launch)\n"),
+            cache ? _T("on") : _T("off"), launchPerSec[cache], enqueueMs * 1e3 / launchCount, totalMs * 1e3 / launchCount);
+    }
+    kernel.get()->setArgCacheEnabled(true);
+    result += strsprintf(_T("  arg cache speedup: x%.2f\n"), launchPerSec[1] / launchPerSec[0]);
+    return 0;
+}
+
+int _tmain(const int argc, const TCHAR **argv) {
+    AviutlAufExeParams prms;
+    if (parse_cmd(prms, false, argc, argv) != 0) {
+        return 1;
+    }
+    if (prms.clinfo) {
+        const auto str = getOpenCLInfo(CL_DEVICE_TYPE_GPU);
+        _ftprintf(stdout, _T("%s\n"), str.c_str());
+        return 0;
+    }
+    if (prms.checkConvertCsp) {
+        tstring str;
+        const int err = clcuCheckConvertCSP(str);
+        _ftprintf(stdout, _T("%s"), str.c_str());
+        return (err > 0) ? 1 : 0;
+    }
+    if (prms.benchLaunch) {
+        tstring str;
+        const int err = benchKernelLaunch(str);
+        _ftprintf(stdout, _T("%s"), str.c_str());
+        return err;
+    }
+    if (prms.checkDevice) {
+        clFiltersExe clfilterexe(prms.noNVCL);
+        const auto str = clfilterexe.checkDevices();
+        _ftprintf(stdout, _T("%s\n"), str.c_str());
+        return 0;
+    }
+    // 構造体サイズの一致を確認
+    if (prms.sizeSharedPrm != sizeof(clfitersSharedPrms)) {
+        _ftprintf(stderr, _T("Invalid size for shared param: %d\n"), prms.sizeSharedPrm);
+        return 1;
+    }
+    if (prms.sizeSharedMesData != sizeof(clfitersSharedMesData)) {
+        _ftprintf(stderr, _T("Invalid size for shared message data: %d\n"), prms.sizeSharedMesData);
+        return 1;
+    }
+    if (prms.sizePIXELYC != SIZE_PIXEL_YC) {
+        _ftprintf(stderr, _T("Invalid size for PIXEL_YC: %d\n"), prms.sizeSharedMesData);
+        return 1;
+    }
+    if (!prms.eventMesStart) {
+        _ftprintf(stderr, _T("Event handle(start) not set.\n"));
+        return 1;
+    }
+    if (!prms.eventMesEnd) {
+        _ftprintf(stderr, _T("Event handle(end) not set.\n"));
+        return 1;
+    }
+    // 実行開始
+    clFiltersExe clfilterexe(prms.noNVCL, prms.colorspaceLUTBake, prms.launchReplay, prms.frameArena, prms.transferStaging, prms.chainFp16, prms.workSizeTune);
+    clfilterexe.init(prms);
+    int ret = clfilterexe.run();
+    return ret;
+}
+
+
@@ -1,10 +1,10 @@
-﻿// cufilters_common.cpp : スタティック ライブラリ用の関数を定義します。
-//
-
-#include "pch.h"
-#include "framework.h"
-
-// TODO: これは、ライブラリ関数の例です
-void fncufilterscommon()
-{
-}
+﻿// cufilters_common.cpp : スタティック ライブラリ用の関数を定義します。
+//
+
+#include "pch.h"
+#include "framework.h"
+
+// TODO: これは、ライブラリ関数の例です
+void fncufilterscommon()
+{
+}
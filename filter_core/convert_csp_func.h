@@ -1,78 +1,78 @@
-﻿// -----------------------------------------------------------------------------------------
-// QSVEnc/NVEnc by rigaya
-// -----------------------------------------------------------------------------------------
-// The MIT License
-//
-// Copyright (c) 2011-2016 rigaya
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-// ------------------------------------------------------------------------------------------
-
-#ifndef _CONVERT_CSP_FUNC_H_
-#define _CONVERT_CSP_FUNC_H_
-
-#include <thread>
-#include <vector>
-#include <memory>
-#include "rgy_osdep.h"
-#include "convert_csp.h"
-#include "rgy_thread_affinity.h"
-#include "rgy_util.h"
-
-struct RGYConvertCSPPrm {
-    bool abort;
-    void **dst;
-    const void **src;
-    int interlaced;
-    int width;
-    int src_y_pitch_byte;
-    int src_uv_pitch_byte;
-    int dst_y_pitch_byte;
-    int height;
-    int dst_height;
-    int *crop;
-
-    RGYConvertCSPPrm();
-};
-
-class RGYConvertCSP {
-private:
-    const ConvertCSP *m_csp;
-    RGY_CSP m_csp_from;
-    RGY_CSP m_csp_to;
-    bool m_uv_only;
-    int m_threads;
-    std::vector<std::thread> m_th;
-    std::vector<std::unique_ptr<void, handle_deleter>> m_heStart;
-    std::vector<std::unique_ptr<void, handle_deleter>> m_heFin;
-    std::vector<HANDLE> m_heFinCopy;
-    RGYParamThread m_threadParam;
-    RGYConvertCSPPrm m_prm;
-public:
-    RGYConvertCSP();
-    RGYConvertCSP(int threads, RGYParamThread threadParam);
-    ~RGYConvertCSP();
-    const ConvertCSP *getFunc(RGY_CSP csp_from, RGY_CSP csp_to, bool uv_only, RGY_SIMD simd);
-    const ConvertCSP *getFunc() const { return m_csp; };
-
-    int run(int interlaced, void **dst, const void **src, int width, int src_y_pitch_byte, int src_uv_pitch_byte, int dst_y_pitch_byte, int height, int dst_height, int *crop);
-};
-
-#endif //_CONVERT_CSP_FUNC_H_
+﻿// -----------------------------------------------------------------------------------------
+// QSVEnc/NVEnc by rigaya
+// -----------------------------------------------------------------------------------------
+// The MIT License
+//
+// Copyright (c) 2011-2016 rigaya
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// ------------------------------------------------------------------------------------------
+
+#ifndef _CONVERT_CSP_FUNC_H_
+#define _CONVERT_CSP_FUNC_H_
+
+#include <thread>
+#include <vector>
+#include <memory>
+#include "rgy_osdep.h"
+#include "convert_csp.h"
+#include "rgy_thread_affinity.h"
+#include "rgy_util.h"
+
+struct RGYConvertCSPPrm {
+    bool abort;
+    void **dst;
+    const void **src;
+    int interlaced;
+    int width;
+    int src_y_pitch_byte;
+    int src_uv_pitch_byte;
+    int dst_y_pitch_byte;
+    int height;
+    int dst_height;
+    int *crop;
+
+    RGYConvertCSPPrm();
+};
+
+class RGYConvertCSP {
+private:
+    const ConvertCSP *m_csp;
+    RGY_CSP m_csp_from;
+    RGY_CSP m_csp_to;
+    bool m_uv_only;
+    int m_threads;
+    std::vector<std::thread> m_th;
+    std::vector<std::unique_ptr<void, handle_deleter>> m_heStart;
+    std::vector<std::unique_ptr<void, handle_deleter>> m_heFin;
+    std::vector<HANDLE> m_heFinCopy;
+    RGYParamThread m_threadParam;
+    RGYConvertCSPPrm m_prm;
+public:
+    RGYConvertCSP();
+    RGYConvertCSP(int threads, RGYParamThread threadParam);
+    ~RGYConvertCSP();
+    const ConvertCSP *getFunc(RGY_CSP csp_from, RGY_CSP csp_to, bool uv_only, RGY_SIMD simd);
+    const ConvertCSP *getFunc() const { return m_csp; };
+
+    int run(int interlaced, void **dst, const void **src, int width, int src_y_pitch_byte, int src_uv_pitch_byte, int dst_y_pitch_byte, int height, int dst_height, int *crop);
+};
+
+#endif //_CONVERT_CSP_FUNC_H_